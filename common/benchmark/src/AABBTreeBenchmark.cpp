@@ -63,7 +63,7 @@ namespace TrenchBroom {
 
     TEST(AABBTreeBenchmark, benchBuildTree) {
 
-        const auto mapPath = IO::Disk::getCurrentWorkingDir() + IO::Path("fixture/benchmark/AABBTree/ne_ruins.map");
+        const auto mapPath = IO::Disk::getCurrentWorkingDir() + IO::Path("fixture/test/IO/Map/rtz_q1.map");
         const auto file = IO::Disk::openFile(mapPath);
         auto fileReader = file->reader().buffer();
 
@@ -0,0 +1,124 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "BenchmarkUtils.h"
+
+#include "Exceptions.h"
+#include "Logger.h"
+#include "IO/File.h"
+#include "IO/FileSystem.h"
+#include "IO/Path.h"
+#include "IO/Quake3ShaderFileSystem.h"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace IO {
+        /**
+         * A file system that keeps its directories and files in memory.
+         */
+        class MemoryFileSystem : public FileSystem {
+        private:
+            std::map<Path, std::vector<Path>> m_directories;
+            std::map<Path, std::string> m_files;
+        public:
+            MemoryFileSystem() {
+                m_directories[Path()];
+            }
+
+            void addFile(const Path& path, std::string contents) {
+                addDirectory(path.deleteLastComponent());
+                m_directories[path.deleteLastComponent()].push_back(path.lastComponent());
+                m_files[path] = std::move(contents);
+            }
+        private:
+            void addDirectory(const Path& path) {
+                if (path.isEmpty() || m_directories.count(path) > 0u) {
+                    return;
+                }
+
+                addDirectory(path.deleteLastComponent());
+                m_directories[path.deleteLastComponent()].push_back(path.lastComponent());
+                m_directories[path];
+            }
+
+            bool doDirectoryExists(const Path& path) const override {
+                return m_directories.count(path) > 0u;
+            }
+
+            bool doFileExists(const Path& path) const override {
+                return m_files.count(path) > 0u;
+            }
+
+            std::vector<Path> doGetDirectoryContents(const Path& path) const override {
+                const auto it = m_directories.find(path);
+                if (it == std::end(m_directories)) {
+                    throw FileSystemException("Directory not found: '" + path.asString() + "'");
+                }
+                return it->second;
+            }
+
+            std::shared_ptr<File> doOpenFile(const Path& path) const override {
+                const auto it = m_files.find(path);
+                if (it == std::end(m_files)) {
+                    throw FileSystemException("File not found: '" + path.asString() + "'");
+                }
+
+                const auto& contents = it->second;
+                auto buffer = std::make_unique<char[]>(contents.size());
+                std::memcpy(buffer.get(), contents.data(), contents.size());
+                return std::make_shared<OwningBufferFile>(path, std::move(buffer), contents.size());
+            }
+        };
+
+        TEST(Quake3ShaderFileSystemBenchmark, linkManyShaders) {
+            constexpr auto ImageCount = 50000u;
+            constexpr auto ShaderCount = 10000u;
+            constexpr auto ShadersPerFile = 100u;
+
+            auto fs = std::make_shared<MemoryFileSystem>();
+            for (auto i = 0u; i < ImageCount; ++i) {
+                fs->addFile(Path("textures/set" + std::to_string(i % 100u) + "/image" + std::to_string(i) + ".tga"), "");
+            }
+
+            for (auto i = 0u; i < ShaderCount / ShadersPerFile; ++i) {
+                std::stringstream str;
+                for (auto j = 0u; j < ShadersPerFile; ++j) {
+                    // every other shader links an existing image, the rest are left without an image
+                    const auto index = 2u * (i * ShadersPerFile + j);
+                    const auto name = "textures/set" + std::to_string(index % 100u) + "/image" + std::to_string(index);
+                    str << name << "\n{\n    qer_editorimage " << name << ".tga\n    surfaceparm noimpact\n}\n\n";
+                }
+                fs->addFile(Path("scripts/shaders" + std::to_string(i) + ".shader"), str.str());
+            }
+
+            NullLogger logger;
+            timeLambda([&]() {
+                Quake3ShaderFileSystem shaderFs(fs, Path("scripts"), { Path("textures") }, logger);
+            }, "load and link " + std::to_string(ShaderCount) + " shaders against " + std::to_string(ImageCount) + " images");
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "BenchmarkUtils.h"
+
+#include "Model/Brush.h"
+#include "Model/BrushBuilder.h"
+#include "Model/BrushFace.h"
+#include "Model/MapFormat.h"
+#include "Model/World.h"
+
+#include <kdl/vector_utils.h>
+
+#include <vecmath/bbox.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        static constexpr size_t NumBrushes = 64'000;
+
+        static void benchmarkFaces(const MapFormat format) {
+            const vm::bbox3 worldBounds(4096.0);
+            World world(format);
+            BrushBuilder builder(&world, worldBounds);
+
+            std::vector<Brush*> brushes;
+            brushes.reserve(NumBrushes);
+            timeLambda([&]() {
+                for (size_t i = 0; i < NumBrushes; ++i) {
+                    brushes.push_back(builder.createCube(64.0, ""));
+                }
+            }, "create " + std::to_string(NumBrushes) + " cubes");
+
+            std::vector<Brush*> clones;
+            clones.reserve(NumBrushes);
+            timeLambda([&]() {
+                for (const auto* brush : brushes) {
+                    clones.push_back(brush->clone(worldBounds));
+                }
+            }, "clone " + std::to_string(NumBrushes) + " cubes");
+
+            size_t faceCount = 0;
+            for (const auto* brush : brushes) {
+                faceCount += brush->faceCount();
+            }
+            printf("%zu faces, %zu bytes per face object, %zu bytes of face objects in total\n",
+                   faceCount, sizeof(BrushFace), faceCount * sizeof(BrushFace));
+
+            kdl::vec_clear_and_delete(clones);
+            kdl::vec_clear_and_delete(brushes);
+        }
+
+        TEST(BrushFaceBenchmark, paraxialFaces) {
+            benchmarkFaces(MapFormat::Standard);
+        }
+
+        TEST(BrushFaceBenchmark, parallelFaces) {
+            benchmarkFaces(MapFormat::Valve);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "BenchmarkUtils.h"
+
+#include "IO/DiskIO.h"
+#include "IO/NodeReader.h"
+#include "IO/Path.h"
+#include "IO/TestParserStatus.h"
+#include "Model/Brush.h"
+#include "Model/BrushBuilder.h"
+#include "Model/MapFormat.h"
+#include "Model/World.h"
+
+#include <kdl/vector_utils.h>
+
+#include <vecmath/bbox.h>
+#include <vecmath/vec.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        static std::vector<Brush*> readSubtrahends(World& world, const vm::bbox3& worldBounds) {
+            const auto subtrahendPath = IO::Disk::getCurrentWorkingDir() + IO::Path("fixture/test/Model/Brush/subtrahend.map");
+            std::ifstream stream(subtrahendPath.asString());
+            std::stringstream subtrahendStr;
+            subtrahendStr << stream.rdbuf();
+
+            IO::TestParserStatus status;
+            return kdl::vec_element_cast<Brush*>(IO::NodeReader::read(subtrahendStr.str(), world, worldBounds, status));
+        }
+
+        /**
+         * Fills the bounds of the given brushes with a grid of cubes.
+         */
+        static std::vector<Brush*> makeMinuends(World& world, const vm::bbox3& worldBounds, const std::vector<Brush*>& subtrahends) {
+            constexpr auto CubeSize = 32.0;
+
+            auto bounds = subtrahends.front()->logicalBounds();
+            for (const auto* subtrahend : subtrahends) {
+                bounds = vm::merge(bounds, subtrahend->logicalBounds());
+            }
+
+            const BrushBuilder builder(&world, worldBounds);
+
+            auto result = std::vector<Brush*>();
+            for (auto x = bounds.min.x(); x < bounds.max.x(); x += CubeSize) {
+                for (auto y = bounds.min.y(); y < bounds.max.y(); y += CubeSize) {
+                    for (auto z = bounds.min.z(); z < bounds.max.z(); z += CubeSize) {
+                        const auto min = vm::vec3(x, y, z);
+                        result.push_back(builder.createCuboid(vm::bbox3(min, min + vm::vec3::fill(CubeSize)), "minuend"));
+                    }
+                }
+            }
+            return result;
+        }
+
+        TEST(CsgSubtractBenchmark, subtractDome) {
+            const vm::bbox3 worldBounds(8192.0);
+            World world(MapFormat::Standard);
+
+            auto subtrahends = readSubtrahends(world, worldBounds);
+            ASSERT_FALSE(subtrahends.empty());
+
+            auto minuends = makeMinuends(world, worldBounds, subtrahends);
+
+            size_t sequentialFragments = 0u;
+            timeLambda([&]() {
+                for (const auto* minuend : minuends) {
+                    auto fragments = minuend->subtract(world, worldBounds, "texture", subtrahends);
+                    sequentialFragments += fragments.size();
+                    kdl::vec_clear_and_delete(fragments);
+                }
+            }, "subtract " + std::to_string(subtrahends.size()) + " subtrahends from " + std::to_string(minuends.size()) + " minuends one by one");
+
+            // only pass the subtrahends which touch a minuend, like MapDocument::csgSubtract does
+            const auto touchingSubtrahends = kdl::vec_transform(minuends, [&](const Brush* minuend) {
+                auto result = subtrahends;
+                kdl::vec_erase_if(result, [&](const Brush* subtrahend) { return !subtrahend->intersects(minuend); });
+                return result;
+            });
+
+            size_t parallelFragments = 0u;
+            timeLambda([&]() {
+                auto fragments = Brush::subtractAll(world, worldBounds, "texture", minuends, touchingSubtrahends);
+                for (auto& minuendFragments : fragments) {
+                    parallelFragments += minuendFragments.size();
+                    kdl::vec_clear_and_delete(minuendFragments);
+                }
+            }, "subtract touching subtrahends from " + std::to_string(minuends.size()) + " minuends in parallel");
+
+            ASSERT_EQ(sequentialFragments, parallelFragments);
+
+            kdl::vec_clear_and_delete(minuends);
+            kdl::vec_clear_and_delete(subtrahends);
+        }
+    }
+}
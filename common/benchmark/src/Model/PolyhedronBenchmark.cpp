@@ -0,0 +1,102 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "BenchmarkUtils.h"
+
+#include "Model/Polyhedron.h"
+#include "Model/Polyhedron_DefaultPayload.h"
+#include "Model/Polyhedron_Instantiation.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/plane.h>
+#include <vecmath/vec.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        using Polyhedron3d = Polyhedron<double, DefaultPolyhedronPayload, DefaultPolyhedronPayload>;
+
+        static std::vector<vm::plane3d> makePlanes(const size_t count, const double radius) {
+            std::mt19937 gen(0u);
+            std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+            std::vector<vm::plane3d> result;
+            result.reserve(count);
+            while (result.size() < count) {
+                const auto normal = vm::vec3d(dist(gen), dist(gen), dist(gen));
+                if (vm::squared_length(normal) > 0.01) {
+                    result.emplace_back(radius, vm::normalize(normal));
+                }
+            }
+            return result;
+        }
+
+        TEST(PolyhedronBenchmark, clipCubes) {
+            constexpr auto NumPolyhedra = 20000u;
+            constexpr auto NumPlanes = 16u;
+
+            // planes that are tangent to a sphere within the cube, so almost every clip cuts off a corner or an edge
+            const auto planes = makePlanes(NumPlanes, 48.0);
+            const auto bounds = vm::bbox3d(64.0);
+
+            size_t vertexCount = 0u;
+            timeLambda([&]() {
+                for (size_t i = 0u; i < NumPolyhedra; ++i) {
+                    auto polyhedron = Polyhedron3d(bounds);
+                    for (const auto& plane : planes) {
+                        polyhedron.clip(plane);
+                    }
+                    vertexCount += polyhedron.vertexCount();
+                }
+            }, "clip " + std::to_string(NumPolyhedra) + " cubes with " + std::to_string(NumPlanes) + " planes each");
+
+            ASSERT_GT(vertexCount, 0u);
+        }
+
+        TEST(PolyhedronBenchmark, clipUnchanged) {
+            constexpr auto NumClips = 1000000u;
+
+            // clip a polyhedron with many vertices by planes that don't touch it, so that only the vertices are classified
+            auto polyhedron = Polyhedron3d(vm::bbox3d(64.0));
+            for (const auto& plane : makePlanes(64u, 96.0)) {
+                polyhedron.clip(plane);
+            }
+            for (const auto& plane : makePlanes(64u, 100.0)) {
+                polyhedron.clip(plane);
+            }
+
+            const auto planes = makePlanes(256u, 1024.0);
+            size_t unchanged = 0u;
+            timeLambda([&]() {
+                for (size_t i = 0u; i < NumClips; ++i) {
+                    if (polyhedron.clip(planes[i % planes.size()]).unchanged()) {
+                        ++unchanged;
+                    }
+                }
+            }, "clip a polyhedron with " + std::to_string(polyhedron.vertexCount()) + " vertices " + std::to_string(NumClips) + " times without changing it");
+
+            ASSERT_EQ(NumClips, unchanged);
+        }
+    }
+}
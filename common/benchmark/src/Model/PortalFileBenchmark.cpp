@@ -0,0 +1,108 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "BenchmarkUtils.h"
+
+#include "IO/DiskIO.h"
+#include "IO/Path.h"
+#include "Model/PortalFile.h"
+
+#include <kdl/string_utils.h>
+
+#include <vecmath/polygon.h>
+#include <vecmath/vec.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        /**
+         * Writes a PRT1 file containing the given number of quadrilateral portals.
+         */
+        static void writePortalFile(const IO::Path& path, const size_t portalCount) {
+            std::ofstream stream(path.asString());
+            stream << "PRT1\n" << portalCount + 1u << "\n" << portalCount << "\n";
+            for (size_t i = 0u; i < portalCount; ++i) {
+                const auto x = static_cast<float>(i % 512u) * 16.0f - 4096.0f;
+                const auto y = static_cast<float>((i / 512u) % 512u) * 16.0f - 4096.0f;
+                const auto z = static_cast<float>(i / (512u * 512u)) * 16.0f + 0.5f;
+                stream << "4 " << i << " " << i + 1u
+                       << " (" << x << " " << y << " " << z << " )"
+                       << " (" << x << " " << y + 16.0f << " " << z << " )"
+                       << " (" << x + 16.0f << " " << y + 16.0f << " " << z << " )"
+                       << " (" << x + 16.0f << " " << y << " " << z << " ) \n";
+            }
+        }
+
+        /**
+         * Reads the portals of the given PRT1 file one line at a time like PortalFile did before it parsed in parallel.
+         */
+        static std::vector<vm::polygon3f> readPortalsSequentially(const IO::Path& path) {
+            std::fstream stream(path.asString(), std::ios::in);
+
+            std::string line;
+            std::getline(stream, line); // format
+            std::getline(stream, line); // number of leafs
+            std::getline(stream, line); // number of portals
+            const auto numPortals = std::stoi(line);
+
+            std::vector<vm::polygon3f> result;
+            for (int i = 0; i < numPortals; ++i) {
+                std::getline(stream, line);
+                const auto components = kdl::str_split(line, "() \n\t\r");
+
+                std::vector<vm::vec3f> verts;
+                const auto numPoints = std::stoi(components.at(0));
+                for (int j = 0; j < numPoints; ++j) {
+                    const auto ptr = static_cast<size_t>(3 + 3 * j);
+                    verts.emplace_back(std::stof(components.at(ptr)), std::stof(components.at(ptr + 1u)), std::stof(components.at(ptr + 2u)));
+                }
+                result.push_back(vm::polygon3f(verts));
+            }
+            return result;
+        }
+
+        TEST(PortalFileBenchmark, loadLargePortalFile) {
+            constexpr size_t PortalCount = 500000u;
+
+            const auto path = IO::Disk::getCurrentWorkingDir() + IO::Path("benchmark.prt");
+            writePortalFile(path, PortalCount);
+
+            std::vector<vm::polygon3f> sequentialPortals;
+            timeLambda([&]() {
+                sequentialPortals = readPortalsSequentially(path);
+            }, "Read " + std::to_string(PortalCount) + " portals line by line");
+
+            std::vector<vm::polygon3f> parallelPortals;
+            timeLambda([&]() {
+                parallelPortals = PortalFile(path).portals();
+            }, "Load " + std::to_string(PortalCount) + " portals in parallel");
+
+            std::remove(path.asString().c_str());
+
+            ASSERT_EQ(PortalCount, parallelPortals.size());
+            ASSERT_EQ(sequentialPortals, parallelPortals);
+        }
+    }
+}
@@ -25,14 +25,20 @@
 #include <vecmath/scalar.h>
 #include <vecmath/bbox.h>
 #include <vecmath/bbox_io.h>
+#include <vecmath/plane.h>
 #include <vecmath/ray.h>
 #include <vecmath/intersection.h>
 
 #include <kdl/overloaded.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iosfwd>
+#include <iterator>
+#include <limits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace TrenchBroom {
@@ -369,6 +375,14 @@ namespace TrenchBroom {
                 }
             }
         public:
+            const Node* left() const {
+                return m_left;
+            }
+
+            const Node* right() const {
+                return m_right;
+            }
+
             void appendTo(std::ostream& str, const std::string& indent, const size_t level) const override {
                 for (size_t i = 0; i < level; ++i)
                     str << indent;
@@ -486,18 +500,78 @@ namespace TrenchBroom {
         }
 
         /**
-         * Clears this tree and rebuilds it by inserting given objects.
+         * Clears this tree and rebuilds it from the given objects.
+         *
+         * Rather than inserting the objects one by one, the tree is built top down by recursively splitting the
+         * objects at the median of their centers along the axis where the centers are spread the most. This is
+         * considerably faster than incremental insertion and yields a balanced tree.
          *
          * @param objects the objects to insert, a list of DataType
          * @param getBounds a function from DataType -> Box to compute the bounds of each object
+         *
+         * @throws NodeTreeException if the given objects contain duplicates or if any bounds contains NaN
          */
         template <typename DataList, typename GetBounds>
         void clearAndBuild(const DataList& objects, GetBounds&& getBounds) {
             clear();
+
+            std::vector<BuildEntry> entries;
+            entries.reserve(static_cast<size_t>(std::distance(std::begin(objects), std::end(objects))));
+
+            // validate all bounds before touching m_leafForData so that the tree remains empty if any check fails
             for (const U& object : objects) {
-                insert(getBounds(object), object);
+                const auto bounds = getBounds(object);
+                check(bounds);
+                entries.emplace_back(bounds, object);
+            }
+
+            for (const auto& entry : entries) {
+                if (!m_leafForData.emplace(entry.second, nullptr).second) {
+                    m_leafForData.clear();
+                    throw NodeTreeException("Data already in tree");
+                }
+            }
+
+            if (!entries.empty()) {
+                m_root = build(std::begin(entries), std::end(entries));
             }
         }
+    private:
+        using BuildEntry = std::pair<Box, U>;
+        using BuildIterator = typename std::vector<BuildEntry>::iterator;
+
+        /**
+         * Builds a subtree containing the given range of entries. The leafs are registered in m_leafForData.
+         *
+         * @param begin the start of the range
+         * @param end the end of the range
+         * @return the root of the subtree
+         */
+        Node* build(BuildIterator begin, BuildIterator end) {
+            assert(begin != end);
+
+            if (std::next(begin) == end) {
+                auto* leaf = new LeafNode(begin->first, begin->second);
+                m_leafForData[begin->second] = leaf;
+                return leaf;
+            }
+
+            typename Box::builder centers;
+            for (auto it = begin; it != end; ++it) {
+                centers.add(it->first.center());
+            }
+            const auto axis = vm::find_abs_max_component(centers.bounds().size());
+
+            auto mid = begin + std::distance(begin, end) / 2;
+            std::nth_element(begin, mid, end, [axis](const BuildEntry& lhs, const BuildEntry& rhs) {
+                return lhs.first.center()[axis] < rhs.first.center()[axis];
+            });
+
+            auto* left = build(begin, mid);
+            auto* right = build(mid, end);
+            return new InnerNode(left, right);
+        }
+    public:
 
         /**
          * Insert a node with the given bounds and data into this tree.
@@ -571,6 +645,96 @@ namespace TrenchBroom {
                 throw NodeTreeException("Cannot add node to AABB tree with invalid bounds");
             }
         }
+
+        /**
+         * Indicates whether the given bounds lie entirely above any of the given planes.
+         */
+        static bool isAbovePlane(const Box& bounds, const std::vector<vm::plane<T,S>>& planes) {
+            for (const auto& plane : planes) {
+                // the corner of the bounds which is farthest below the plane
+                auto corner = bounds.min;
+                for (std::size_t i = 0u; i < S; ++i) {
+                    if (plane.normal[i] < static_cast<T>(0)) {
+                        corner[i] = bounds.max[i];
+                    }
+                }
+                if (plane.point_distance(corner) > static_cast<T>(0)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Visits the nodes hit by a ray front to back and keeps track of the closest hit. The children of an inner node
+         * are visited in the order in which the ray enters their bounds, and a child is skipped if the ray enters its
+         * bounds behind the closest hit found so far.
+         */
+        template <typename F>
+        class ClosestIntersectorVisitor : public Visitor {
+        private:
+            const vm::ray<T,S>& m_ray;
+            const F& m_intersect;
+            T m_closest;
+        public:
+            ClosestIntersectorVisitor(const vm::ray<T,S>& ray, const F& intersect) :
+                m_ray(ray),
+                m_intersect(intersect),
+                m_closest(std::numeric_limits<T>::max()) {}
+
+            T closest() const {
+                return m_closest;
+            }
+
+            void visitIfCloser(const Node* node) {
+                if (entryDistance(node->bounds()) <= m_closest) {
+                    node->accept(*this);
+                }
+            }
+
+            bool visit(const InnerNode* innerNode) override {
+                const Node* first = innerNode->left();
+                const Node* second = innerNode->right();
+
+                auto firstDistance = entryDistance(first->bounds());
+                auto secondDistance = entryDistance(second->bounds());
+                if (secondDistance < firstDistance) {
+                    std::swap(first, second);
+                    std::swap(firstDistance, secondDistance);
+                }
+
+                if (firstDistance <= m_closest) {
+                    first->accept(*this);
+                }
+                // the closest hit may have moved in front of the second child
+                if (secondDistance <= m_closest) {
+                    second->accept(*this);
+                }
+
+                // the children have already been visited
+                return false;
+            }
+
+            void visit(const LeafNode* leaf) override {
+                const auto distance = m_intersect(leaf->data());
+                if (!vm::is_nan(distance) && distance < m_closest) {
+                    m_closest = distance;
+                }
+            }
+        private:
+            /**
+             * Returns the distance at which the ray enters the given bounds, or infinity if it misses them. Since the
+             * closest hit distance is initialized with the maximum value, missed bounds are never visited.
+             */
+            T entryDistance(const Box& bounds) const {
+                if (bounds.contains(m_ray.origin)) {
+                    return static_cast<T>(0);
+                }
+
+                const auto distance = vm::intersect_ray_bbox(m_ray, bounds);
+                return vm::is_nan(distance) ? std::numeric_limits<T>::infinity() : distance;
+            }
+        };
     public:
         /**
          * Clears this node tree.
@@ -580,6 +744,7 @@ namespace TrenchBroom {
                 delete m_root;
                 m_root = nullptr;
             }
+            m_leafForData.clear();
         }
 
         /**
@@ -655,6 +820,30 @@ namespace TrenchBroom {
             }
         }
 
+        /**
+         * Finds the closest hit of the given ray among the data items in this tree. The tree is traversed front to
+         * back, and subtrees whose bounds the ray enters behind the closest hit found so far are skipped entirely.
+         *
+         * The given function is called with every data item that may yield a closer hit. It must return the distance
+         * of the item's hit along the ray, or NaN if the item is not hit or should be ignored. The distance of a hit
+         * must not be less than the distance at which the ray enters the item's bounds.
+         *
+         * @tparam F the type of the function to call
+         * @param ray the ray to test
+         * @param intersect the function that computes the hit distance of a data item
+         * @return the distance of the closest hit, or NaN if no data item was hit
+         */
+        template <typename F>
+        T findClosestIntersector(const vm::ray<T,S>& ray, const F& intersect) const {
+            if (empty()) {
+                return vm::nan<T>();
+            }
+
+            ClosestIntersectorVisitor<F> visitor(ray, intersect);
+            visitor.visitIfCloser(m_root);
+            return visitor.closest() < std::numeric_limits<T>::max() ? visitor.closest() : vm::nan<T>();
+        }
+
         /**
          * Finds every data item in this tree whose bounding box contains the given point and returns a list of those items.
          *
@@ -693,6 +882,90 @@ namespace TrenchBroom {
             }
         }
 
+        /**
+         * Finds every data item in this tree whose bounding box intersects with the given bounding box and returns a
+         * list of those items.
+         *
+         * @param bounds the bounding box to test
+         * @return a list containing all found data items
+         */
+        List findIntersectors(const Box& bounds) const {
+            List result;
+            findIntersectors(bounds, std::back_inserter(result));
+            return result;
+        }
+
+        /**
+         * Finds every data item in this tree whose bounding box intersects with the given bounding box and appends it
+         * to the given output iterator.
+         *
+         * @tparam O the output iterator type
+         * @param bounds the bounding box to test
+         * @param out the output iterator to append to
+         */
+        template <typename O>
+        void findIntersectors(const Box& bounds, O out) const {
+            if (!empty()) {
+                LambdaVisitor visitor(
+                    [&](const InnerNode* innerNode) {
+                        return innerNode->bounds().intersects(bounds);
+                    },
+                    [&](const LeafNode* leaf) {
+                        if (leaf->bounds().intersects(bounds)) {
+                            out = leaf->data();
+                            ++out;
+                        }
+                    }
+                );
+                m_root->accept(visitor);
+            }
+        }
+
+        /**
+         * Finds every data item in this tree whose bounding box may intersect the convex volume bounded by the given
+         * planes, e.g. a brush or a view frustum, and returns a list of those items. A point lies inside the volume if
+         * it is not above any of the planes.
+         *
+         * An item is found unless its bounding box lies entirely above one of the planes. This never misses an item
+         * that intersects the volume, but near the edges of the volume it may find items that don't intersect it, so
+         * the caller must test the found items exactly.
+         *
+         * @param planes the planes bounding the volume
+         * @return a list containing all found data items
+         */
+        List findIntersectors(const std::vector<vm::plane<T,S>>& planes) const {
+            List result;
+            findIntersectors(planes, std::back_inserter(result));
+            return result;
+        }
+
+        /**
+         * Finds every data item in this tree whose bounding box may intersect the convex volume bounded by the given
+         * planes and appends it to the given output iterator. Subtrees whose bounds lie entirely above any of the
+         * planes are skipped.
+         *
+         * @tparam O the output iterator type
+         * @param planes the planes bounding the volume
+         * @param out the output iterator to append to
+         */
+        template <typename O>
+        void findIntersectors(const std::vector<vm::plane<T,S>>& planes, O out) const {
+            if (!empty()) {
+                LambdaVisitor visitor(
+                    [&](const InnerNode* innerNode) {
+                        return !isAbovePlane(innerNode->bounds(), planes);
+                    },
+                    [&](const LeafNode* leaf) {
+                        if (!isAbovePlane(leaf->bounds(), planes)) {
+                            out = leaf->data();
+                            ++out;
+                        }
+                    }
+                );
+                m_root->accept(visitor);
+            }
+        }
+
         /**
          * Prints a textual representation of this tree to the given output stream.
          *
@@ -21,6 +21,8 @@
 #define TrenchBroom_Allocator_h
 
 #include <cassert>
+#include <cstddef>
+#include <new>
 #include <stack>
 #include <vector>
 
@@ -28,6 +30,37 @@
 #define TB_ENABLE_ALLOCATOR 1
 
 namespace TrenchBroom {
+    /**
+     * The pools of the allocator are not thread safe. While an instance of this class exists, all objects using the
+     * allocator are allocated on and freed to the heap on the current thread instead, so that worker threads can create
+     * and destroy such objects concurrently.
+     *
+     * Objects allocated outside of such a scope must not be deleted within one. Objects allocated within such a scope
+     * may be deleted anywhere.
+     */
+    class AllocatorBypass {
+    public:
+        AllocatorBypass() {
+            ++depth();
+        }
+
+        ~AllocatorBypass() {
+            --depth();
+        }
+
+        AllocatorBypass(const AllocatorBypass&) = delete;
+        AllocatorBypass& operator=(const AllocatorBypass&) = delete;
+
+        static bool active() {
+            return depth() > 0u;
+        }
+    private:
+        static size_t& depth() {
+            thread_local size_t d = 0u;
+            return d;
+        }
+    };
+
     template <class T, size_t PoolSize = 64, size_t BlocksPerChunk = 256>
     class Allocator {
     private:
@@ -112,8 +145,11 @@ namespace TrenchBroom {
         }
     public:
 #ifdef TB_ENABLE_ALLOCATOR
-        void* operator new([[maybe_unused]] size_t size) {
+        void* operator new(size_t size) {
             assert(size == sizeof(T));
+            if (AllocatorBypass::active()) {
+                return ::operator new(size);
+            }
 
             if (!pool().empty()) {
                 T* t = pool().top();
@@ -146,8 +182,12 @@ namespace TrenchBroom {
         }
 
         void operator delete(void* block) {
-            T* t = reinterpret_cast<T*>(block);
+            if (AllocatorBypass::active()) {
+                ::operator delete(block);
+                return;
+            }
 
+            T* t = reinterpret_cast<T*>(block);
             if (PoolSize > 0 && pool().size() < PoolSize) {
                 pool().push(t);
                 return;
@@ -179,7 +219,11 @@ namespace TrenchBroom {
                 }
             }
 
-            assert(chunk != nullptr);
+            if (chunk == nullptr) {
+                // the block was allocated on the heap within an AllocatorBypass scope
+                ::operator delete(block);
+                return;
+            }
 
             if (chunk->full()) {
                 fullChunks().erase((fullIt + 1).base());
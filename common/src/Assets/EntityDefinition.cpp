@@ -176,6 +176,10 @@ namespace TrenchBroom {
             return EntityDefinitionType::PointEntity;
         }
 
+        EntityDefinition* PointEntityDefinition::clone() const {
+            return new PointEntityDefinition(name(), color(), m_bounds, description(), attributeDefinitions(), m_modelDefinition);
+        }
+
         const vm::bbox3& PointEntityDefinition::bounds() const {
             return m_bounds;
         }
@@ -198,5 +202,9 @@ namespace TrenchBroom {
         EntityDefinitionType BrushEntityDefinition::type() const {
             return EntityDefinitionType::BrushEntity;
         }
+
+        EntityDefinition* BrushEntityDefinition::clone() const {
+            return new BrushEntityDefinition(name(), color(), description(), attributeDefinitions());
+        }
     }
 }
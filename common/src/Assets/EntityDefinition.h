@@ -67,6 +67,13 @@ namespace TrenchBroom {
             void setIndex(size_t index);
 
             virtual EntityDefinitionType type() const = 0;
+
+            /**
+             * Returns a new definition with the same name, color, description and attributes. The index and the usage
+             * count of the returned definition are reset, and the attribute definitions are shared.
+             */
+            virtual EntityDefinition* clone() const = 0;
+
             const std::string& name() const;
             std::string shortName() const;
             std::string groupName() const;
@@ -97,6 +104,7 @@ namespace TrenchBroom {
             PointEntityDefinition(const std::string& name, const Color& color, const vm::bbox3& bounds, const std::string& description, const AttributeDefinitionList& attributeDefinitions, const ModelDefinition& modelDefinition);
 
             EntityDefinitionType type() const override;
+            EntityDefinition* clone() const override;
             const vm::bbox3& bounds() const;
             ModelSpecification model(const Model::EntityAttributes& attributes) const;
             ModelSpecification defaultModel() const;
@@ -107,6 +115,7 @@ namespace TrenchBroom {
         public:
             BrushEntityDefinition(const std::string& name, const Color& color, const std::string& description, const AttributeDefinitionList& attributeDefinitions);
             EntityDefinitionType type() const override;
+            EntityDefinition* clone() const override;
         };
     }
 }
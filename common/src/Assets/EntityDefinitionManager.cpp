@@ -28,6 +28,7 @@
 
 #include <kdl/vector_utils.h>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -107,6 +108,7 @@ namespace TrenchBroom {
 
         void EntityDefinitionManager::updateCache() {
             clearCache();
+            m_cache.reserve(m_definitions.size());
             for (EntityDefinition* definition : m_definitions) {
                 m_cache[definition->name()] = definition;
             }
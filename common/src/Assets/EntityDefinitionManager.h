@@ -22,8 +22,8 @@
 
 #include "Notifier.h"
 
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace TrenchBroom {
@@ -45,7 +45,8 @@ namespace TrenchBroom {
 
         class EntityDefinitionManager {
         private:
-            using Cache = std::map<std::string, EntityDefinition*>;
+            // looked up for every entity whose classname changes, so this uses a hashed index
+            using Cache = std::unordered_map<std::string, EntityDefinition*>;
             std::vector<EntityDefinition*> m_definitions;
             std::vector<EntityDefinitionGroup> m_groups;
             Cache m_cache;
@@ -25,12 +25,15 @@
 #include "Renderer/PrimType.h"
 #include "Renderer/TexturedIndexRangeMap.h"
 #include "Renderer/TexturedIndexRangeRenderer.h"
+#include "Renderer/VertexArray.h"
 
 #include <vecmath/forward.h>
 #include <vecmath/bbox.h>
 #include <vecmath/intersection.h>
 
+#include <numeric>
 #include <string>
+#include <vector>
 
 namespace TrenchBroom {
     namespace Assets {
@@ -51,7 +54,7 @@ namespace TrenchBroom {
         EntityModelFrame(index),
         m_name(name),
         m_bounds(bounds),
-        m_spacialTree(std::make_unique<SpacialTree>()) {}
+        m_vertexCount(0) {}
 
         EntityModelLoadedFrame::~EntityModelLoadedFrame() = default;
 
@@ -70,7 +73,12 @@ namespace TrenchBroom {
         float EntityModelLoadedFrame::intersect(const vm::ray3f& ray) const {
             auto closestDistance = vm::nan<float>();
 
-            const auto candidates = m_spacialTree->findIntersectors(ray);
+            // avoid building the spacial tree for frames that the ray does not even come close to
+            if (!m_bounds.contains(ray.origin) && vm::is_nan(vm::intersect_ray_bbox(ray, m_bounds))) {
+                return closestDistance;
+            }
+
+            const auto candidates = spacialTree().findIntersectors(ray);
             for (const TriNum triNum : candidates) {
                 const vm::vec3f& p1 = m_tris[triNum * 3 + 0];
                 const vm::vec3f& p2 = m_tris[triNum * 3 + 1];
@@ -81,6 +89,28 @@ namespace TrenchBroom {
             return closestDistance;
         }
 
+        size_t EntityModelLoadedFrame::vertexCount() const {
+            return m_vertexCount;
+        }
+
+        size_t EntityModelLoadedFrame::addVertices(const std::vector<EntityModelVertex>& vertices) {
+            assert(m_vertexArray == nullptr);
+
+            const auto offset = m_vertices.size();
+            m_vertices.insert(std::end(m_vertices), std::begin(vertices), std::end(vertices));
+            m_vertexCount = m_vertices.size();
+            return offset;
+        }
+
+        const Renderer::VertexArray& EntityModelLoadedFrame::vertexArray() {
+            if (m_vertexArray == nullptr) {
+                // the vertex array releases the vertices once they are uploaded
+                m_vertexArray = std::make_unique<Renderer::VertexArray>(Renderer::VertexArray::move(std::move(m_vertices)));
+                m_vertices = std::vector<EntityModelVertex>();
+            }
+            return *m_vertexArray;
+        }
+
         void EntityModelLoadedFrame::addToSpacialTree(const std::vector<EntityModelVertex>& vertices, const Renderer::PrimType primType, const size_t index, const size_t count) {
             switch (primType) {
                 case Renderer::PrimType::Points:
@@ -92,19 +122,13 @@ namespace TrenchBroom {
                     assert(count % 3 == 0);
                     m_tris.reserve(m_tris.size() + count);
                     for (size_t i = 0; i < count; i += 3) {
-                        vm::bbox3f::builder bounds;
                         const auto& p1 = Renderer::getVertexComponent<0>(vertices[index + i + 0]);
                         const auto& p2 = Renderer::getVertexComponent<0>(vertices[index + i + 1]);
                         const auto& p3 = Renderer::getVertexComponent<0>(vertices[index + i + 2]);
-                        bounds.add(p1);
-                        bounds.add(p2);
-                        bounds.add(p3);
 
-                        const size_t triIndex = m_tris.size() / 3u;
                         m_tris.push_back(p1);
                         m_tris.push_back(p2);
                         m_tris.push_back(p3);
-                        m_spacialTree->insert(bounds.bounds(), triIndex);
                     }
                     break;
                 }
@@ -115,18 +139,12 @@ namespace TrenchBroom {
 
                     const auto& p1 = Renderer::getVertexComponent<0>(vertices[index]);
                     for (size_t i = 1; i < count - 1; ++i) {
-                        vm::bbox3f::builder bounds;
                         const auto& p2 = Renderer::getVertexComponent<0>(vertices[index + i]);
                         const auto& p3 = Renderer::getVertexComponent<0>(vertices[index + i + 1]);
-                        bounds.add(p1);
-                        bounds.add(p2);
-                        bounds.add(p2);
 
-                        const size_t triIndex = m_tris.size() / 3u;
                         m_tris.push_back(p1);
                         m_tris.push_back(p2);
                         m_tris.push_back(p3);
-                        m_spacialTree->insert(bounds.bounds(), triIndex);
                     }
                     break;
                 }
@@ -136,15 +154,10 @@ namespace TrenchBroom {
                     assert(count > 2);
                     m_tris.reserve(m_tris.size() + (count - 2) * 3);
                     for (size_t i = 0; i < count-2; ++i) {
-                        vm::bbox3f::builder bounds;
                         const auto& p1 = Renderer::getVertexComponent<0>(vertices[index + i + 0]);
                         const auto& p2 = Renderer::getVertexComponent<0>(vertices[index + i + 1]);
                         const auto& p3 = Renderer::getVertexComponent<0>(vertices[index + i + 2]);
-                        bounds.add(p1);
-                        bounds.add(p2);
-                        bounds.add(p2);
 
-                        const size_t triIndex = m_tris.size() / 3u;
                         if (i % 2 == 0) {
                             m_tris.push_back(p1);
                             m_tris.push_back(p2);
@@ -154,7 +167,6 @@ namespace TrenchBroom {
                             m_tris.push_back(p3);
                             m_tris.push_back(p2);
                         }
-                        m_spacialTree->insert(bounds.bounds(), triIndex);
                     }
                     break;
                 }
@@ -162,6 +174,27 @@ namespace TrenchBroom {
             }
         }
 
+        bool EntityModelLoadedFrame::hasSpacialTree() const {
+            return m_spacialTree != nullptr;
+        }
+
+        const EntityModelLoadedFrame::SpacialTree& EntityModelLoadedFrame::spacialTree() const {
+            if (m_spacialTree == nullptr) {
+                std::vector<TriNum> triNums(m_tris.size() / 3u);
+                std::iota(std::begin(triNums), std::end(triNums), TriNum(0));
+
+                m_spacialTree = std::make_unique<SpacialTree>();
+                m_spacialTree->clearAndBuild(triNums, [&](const TriNum triNum) {
+                    vm::bbox3f::builder bounds;
+                    bounds.add(m_tris[triNum * 3 + 0]);
+                    bounds.add(m_tris[triNum * 3 + 1]);
+                    bounds.add(m_tris[triNum * 3 + 2]);
+                    return bounds.bounds();
+                });
+            }
+            return *m_spacialTree;
+        }
+
         // EntityModel::UnloadedFrame
 
         /**
@@ -194,36 +227,41 @@ namespace TrenchBroom {
             float intersect(const vm::ray3f& /* ray */) const override {
                 return vm::nan<float>();
             }
+
+            size_t vertexCount() const override {
+                return 0u;
+            }
         };
 
         // EntityModel::Mesh
 
         /**
-         * The mesh associated with a frame and a surface.
+         * The mesh associated with a frame and a surface. The vertices of the mesh are stored in the vertex store of
+         * its frame, which is shared by all surfaces of the frame, and the mesh's indices are relative to that store.
          */
         class EntityModelMesh {
         private:
-            std::vector<EntityModelVertex> m_vertices;
+            EntityModelLoadedFrame& m_frame;
         protected:
             /**
-             * Creates a new frame mesh that uses the given vertices.
+             * Creates a new frame mesh whose vertices are stored in the given frame.
              *
-             * @param vertices the vertices
+             * @param frame the frame to which this mesh belongs
              */
-            explicit EntityModelMesh(const std::vector<EntityModelVertex>& vertices) :
-            m_vertices(vertices) {}
+            explicit EntityModelMesh(EntityModelLoadedFrame& frame) :
+            m_frame(frame) {}
         public:
             virtual ~EntityModelMesh() = default;
         public:
             /**
-             * Returns a renderer that renders this mesh with the given texture.
+             * Returns a renderer that renders this mesh with the given texture. All renderers created for the meshes
+             * of a frame share the frame's vertex array, regardless of the texture used.
              *
              * @param skin the texture to use when rendering the mesh
              * @return the renderer
              */
             std::unique_ptr<Renderer::TexturedIndexRangeRenderer> buildRenderer(Assets::Texture* skin) {
-                const auto vertexArray = Renderer::VertexArray::ref(m_vertices);
-                return doBuildRenderer(skin, vertexArray);
+                return doBuildRenderer(skin, m_frame.vertexArray());
             }
         private:
             /**
@@ -239,26 +277,27 @@ namespace TrenchBroom {
         // EntityModel::IndexedMesh
 
         /**
-         * A model frame mesh for indexed rendering. Stores vertices and vertex indices.
+         * A model frame mesh for indexed rendering. Stores vertex indices into the vertex store of its frame.
          */
         class EntityModelIndexedMesh : public EntityModelMesh {
         private:
             EntityModelIndices m_indices;
         public:
             /**
-             * Creates a new frame mesh with the given vertices and indices.
+             * Creates a new frame mesh with the given vertices and indices. The vertices are added to the given frame.
              *
              * @param frame the frame to which this mesh belongs
              * @param vertices the vertices
              * @param indices the indices
              */
             EntityModelIndexedMesh(EntityModelLoadedFrame& frame, const std::vector<EntityModelVertex>& vertices, const EntityModelIndices& indices) :
-            EntityModelMesh(vertices),
-            m_indices(indices) {
-                m_indices.forEachPrimitive([&frame, &vertices](const Renderer::PrimType primType, const size_t index, const size_t count) {
+            EntityModelMesh(frame) {
+                const auto offset = frame.addVertices(vertices);
+                indices.forEachPrimitive([&](const Renderer::PrimType primType, const size_t index, const size_t count) {
                     frame.addToSpacialTree(vertices, primType, index, count);
+                    m_indices.add(primType, offset + index, count);
                 });
-        }
+            }
         private:
             std::unique_ptr<Renderer::TexturedIndexRangeRenderer> doBuildRenderer(Assets::Texture* skin, const Renderer::VertexArray& vertices) override {
                 const Renderer::TexturedIndexRangeMap texturedIndices(skin, m_indices);
@@ -269,24 +308,27 @@ namespace TrenchBroom {
         // EntityModel::TexturedMesh
 
         /**
-         * A model frame mesh for per texture indexed rendering. Stores vertices and per texture indices.
+         * A model frame mesh for per texture indexed rendering. Stores per texture vertex indices into the vertex
+         * store of its frame.
          */
         class EntityModelTexturedMesh : public EntityModelMesh {
         private:
             EntityModelTexturedIndices m_indices;
         public:
             /**
-             * Creates a new frame mesh with the given vertices and per texture indices.
+             * Creates a new frame mesh with the given vertices and per texture indices. The vertices are added to the
+             * given frame.
              *
              * @param frame the frame to which this mesh belongs
              * @param vertices the vertices
              * @param indices the per texture indices
              */
             EntityModelTexturedMesh(EntityModelLoadedFrame& frame, const std::vector<EntityModelVertex>& vertices, const EntityModelTexturedIndices& indices) :
-            EntityModelMesh(vertices),
-            m_indices(indices) {
-                m_indices.forEachPrimitive([&frame, &vertices](const Assets::Texture* /* texture */, const Renderer::PrimType primType, const size_t index, const size_t count) {
+            EntityModelMesh(frame) {
+                const auto offset = frame.addVertices(vertices);
+                indices.forEachPrimitive([&](const Assets::Texture* texture, const Renderer::PrimType primType, const size_t index, const size_t count) {
                     frame.addToSpacialTree(vertices, primType, index, count);
+                    m_indices.add(texture, primType, offset + index, count);
                 });
             }
         private:
@@ -439,6 +481,18 @@ namespace TrenchBroom {
             return m_surfaces.size();
         }
 
+        size_t EntityModel::vertexCount() const {
+            size_t result = 0u;
+            for (const auto& frame : m_frames) {
+                result += frame->vertexCount();
+            }
+            return result;
+        }
+
+        size_t EntityModel::vertexDataSize() const {
+            return vertexCount() * sizeof(EntityModelVertex);
+        }
+
         std::vector<const EntityModelFrame*> EntityModel::frames() const {
             std::vector<const EntityModelFrame*> result;
             result.reserve(frameCount());
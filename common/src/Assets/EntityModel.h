@@ -36,6 +36,7 @@ namespace TrenchBroom {
         enum class PrimType;
         class TexturedIndexRangeRenderer;
         class TexturedRenderer;
+        class VertexArray;
     }
 
     namespace Assets {
@@ -95,6 +96,13 @@ namespace TrenchBroom {
              * @return the distance to the point of intersection or NaN if the given ray does not intersect this frame
              */
             virtual float intersect(const vm::ray3f& ray) const = 0;
+
+            /**
+             * Returns the number of vertices stored for this frame.
+             *
+             * @return the number of vertices
+             */
+            virtual size_t vertexCount() const = 0;
         };
 
         /**
@@ -105,11 +113,16 @@ namespace TrenchBroom {
             std::string m_name;
             vm::bbox3f m_bounds;
 
-            // For hit testing
+            // The vertices of all surfaces of this frame, shared by the renderers of every surface and skin
+            std::vector<EntityModelVertex> m_vertices;
+            std::unique_ptr<Renderer::VertexArray> m_vertexArray;
+            size_t m_vertexCount;
+
+            // For hit testing, the spacial tree is built from the triangles when it is first needed
             std::vector<vm::vec3f> m_tris;
             using TriNum = size_t;
             using SpacialTree = AABBTree<float, 3, TriNum>;
-            std::unique_ptr<SpacialTree> m_spacialTree;
+            mutable std::unique_ptr<SpacialTree> m_spacialTree;
         public:
             /**
              * Creates a new frame with the given index, name and bounds.
@@ -126,9 +139,27 @@ namespace TrenchBroom {
             const std::string& name() const override;
             const vm::bbox3f& bounds() const override;
             float intersect(const vm::ray3f& ray) const override;
+            size_t vertexCount() const override;
+
+            /**
+             * Appends the given vertices to the vertex store of this frame.
+             *
+             * @param vertices the vertices to append
+             * @return the index of the first appended vertex in the vertex store
+             */
+            size_t addVertices(const std::vector<EntityModelVertex>& vertices);
+
+            /**
+             * Returns a vertex array containing all vertices of this frame. The vertex array is created when this
+             * function is called for the first time; after that, no more vertices can be added to this frame.
+             *
+             * @return the vertex array
+             */
+            const Renderer::VertexArray& vertexArray();
 
             /**
-             * Adds the given primitives to the spacial tree for this frame.
+             * Adds the given primitives to the triangles used for hit testing this frame. The spacial tree is built
+             * from these triangles when this frame is intersected with a ray for the first time.
              *
              * @param vertices the vertices
              * @param primType the primitive type
@@ -136,6 +167,13 @@ namespace TrenchBroom {
              * @param count the number of vertices that make up the primitive(s)
              */
             void addToSpacialTree(const std::vector<EntityModelVertex>& vertices, Renderer::PrimType primType, size_t index, size_t count);
+
+            /**
+             * Indicates whether the spacial tree of this frame has been built.
+             */
+            bool hasSpacialTree() const;
+        private:
+            const SpacialTree& spacialTree() const;
         };
 
         class EntityModelUnloadedFrame;
@@ -349,6 +387,20 @@ namespace TrenchBroom {
              */
             size_t surfaceCount() const;
 
+            /**
+             * Returns the number of vertices stored for all loaded frames of this model.
+             *
+             * @return the number of vertices
+             */
+            size_t vertexCount() const;
+
+            /**
+             * Returns the size of the vertex data of all loaded frames of this model in bytes.
+             *
+             * @return the size in bytes
+             */
+            size_t vertexDataSize() const;
+
             /**
              * Returns all frames of this model.
              *
@@ -28,11 +28,71 @@
 #include "Model/Entity.h"
 #include "Renderer/TexturedIndexRangeRenderer.h"
 
+#include <QString>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <utility>
+
 namespace TrenchBroom {
     namespace Assets {
+        /**
+         * Loads a model and the frame that was requested first on a background thread.
+         */
+        class EntityModelManager::ModelLoadTask {
+        private:
+            ModelSpecification m_spec;
+            BufferedLogger m_logger;
+            // must be declared after the logger since destroying the future waits for the task to finish
+            std::future<std::unique_ptr<EntityModel>> m_future;
+        public:
+            explicit ModelLoadTask(const ModelSpecification& spec) :
+            m_spec(spec) {}
+
+            bool started() const {
+                return m_future.valid();
+            }
+
+            bool finished() const {
+                return started() && m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            }
+
+            void start(const IO::EntityModelLoader& loader) {
+                assert(!started());
+                m_future = std::async(std::launch::async, [&loader, spec = m_spec, &logger = m_logger]() {
+                    auto model = loader.initializeModel(spec.path, logger);
+                    if (model != nullptr && spec.frameIndex < model->frameCount()) {
+                        try {
+                            loader.loadFrame(spec.path, spec.frameIndex, *model, logger);
+                        } catch (const Exception& e) {
+                            logger.error() << "Could not load entity model frame " << spec << ": " << e.what();
+                        }
+                    }
+                    return model;
+                });
+            }
+
+            /**
+             * Waits for the task to finish, forwards the buffered log messages to the given logger and returns the
+             * loaded model.
+             *
+             * @throws GameException if the model could not be loaded
+             */
+            std::unique_ptr<EntityModel> get(Logger& logger) {
+                assert(started());
+                m_future.wait();
+                m_logger.forward(logger);
+                return m_future.get();
+            }
+        };
+
         EntityModelManager::EntityModelManager(const int magFilter, const int minFilter, Logger& logger) :
         m_logger(logger),
         m_loader(nullptr),
+        m_maxConcurrentLoads(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u))),
         m_minFilter(minFilter),
         m_magFilter(magFilter),
         m_resetTextureMode(false) {}
@@ -42,6 +102,8 @@ namespace TrenchBroom {
         }
 
         void EntityModelManager::clear() {
+            cancelPendingLoads();
+
             m_renderers.clear();
             m_models.clear();
             m_rendererMismatches.clear();
@@ -65,7 +127,7 @@ namespace TrenchBroom {
         }
 
         Renderer::TexturedRenderer* EntityModelManager::renderer(const Assets::ModelSpecification& spec) const {
-            auto* entityModel = safeGetModel(spec.path);
+            auto* entityModel = model(spec);
 
             if (entityModel == nullptr) {
                 return nullptr;
@@ -97,7 +159,7 @@ namespace TrenchBroom {
         }
 
         const EntityModelFrame* EntityModelManager::frame(const Assets::ModelSpecification& spec) const {
-            auto* model = this->safeGetModel(spec.path);
+            auto* model = this->model(spec);
             if (model == nullptr) {
                 return nullptr;
             } else if (spec.frameIndex >= model->frameCount()) {
@@ -118,7 +180,54 @@ namespace TrenchBroom {
             return renderer(spec) != nullptr;
         }
 
-        EntityModel* EntityModelManager::model(const IO::Path& path) const {
+        bool EntityModelManager::hasPendingModels() const {
+            return !m_pendingModels.empty();
+        }
+
+        void EntityModelManager::cancelPendingLoads() {
+            // waits for all running tasks to finish, they might still access the loader
+            m_pendingModels.clear();
+        }
+
+        std::vector<IO::Path> EntityModelManager::processLoadedModels() {
+            std::vector<IO::Path> result;
+
+            auto it = std::begin(m_pendingModels);
+            while (it != std::end(m_pendingModels)) {
+                const auto& path = it->first;
+                auto& task = it->second;
+                if (!task->finished()) {
+                    ++it;
+                    continue;
+                }
+
+                try {
+                    auto model = task->get(m_logger);
+                    if (model != nullptr) {
+                        const auto [pos, success] = m_models.insert({ path, std::move(model) });
+                        assert(success); unused(success);
+
+                        auto* loadedModel = pos->second.get();
+                        m_unpreparedModels.push_back(loadedModel);
+                        m_logger.debug() << "Loaded entity model " << path << " (" << loadedModel->vertexCount() << " vertices, " << loadedModel->vertexDataSize() << " bytes)";
+                    } else {
+                        m_modelMismatches.insert(path);
+                    }
+                } catch (const Exception& e) {
+                    m_logger.error() << e.what();
+                    m_modelMismatches.insert(path);
+                }
+
+                result.push_back(path);
+                it = m_pendingModels.erase(it);
+            }
+
+            startPendingLoads();
+            return result;
+        }
+
+        EntityModel* EntityModelManager::model(const ModelSpecification& spec) const {
+            const auto& path = spec.path;
             if (path.isEmpty()) {
                 return nullptr;
             }
@@ -128,44 +237,44 @@ namespace TrenchBroom {
                 return it->second.get();
             }
 
-            if (m_modelMismatches.count(path) > 0) {
-                return nullptr;
+            if (m_modelMismatches.count(path) == 0 && m_pendingModels.count(path) == 0) {
+                loadModel(spec);
             }
 
-            try {
-                const auto [pos, success] = m_models.insert({ path, loadModel(path) });
-                assert(success); unused(success);
-
-                auto* model = pos->second.get();
-                m_unpreparedModels.push_back(model);
-
-                m_logger.debug() << "Loaded entity model " << path;
+            // the model is either invalid or it is still being loaded
+            return nullptr;
+        }
 
-                return model;
-            } catch (const GameException& e) {
-                m_logger.error() << e.what();
-                m_modelMismatches.insert(path);
-                throw;
-            }
+        void EntityModelManager::loadModel(const ModelSpecification& spec) const {
+            ensure(m_loader != nullptr, "loader is null");
+            m_pendingModels.insert({ spec.path, std::make_unique<ModelLoadTask>(spec) });
+            startPendingLoads();
         }
 
-        EntityModel* EntityModelManager::safeGetModel(const IO::Path& path) const {
-            try {
-                return model(path);
-            } catch (const GameException&) {
-                return nullptr;
-            }
+        size_t EntityModelManager::runningLoadCount() const {
+            return static_cast<size_t>(std::count_if(std::begin(m_pendingModels), std::end(m_pendingModels), [](const auto& entry) {
+                return entry.second->started();
+            }));
         }
 
-        std::unique_ptr<EntityModel> EntityModelManager::loadModel(const IO::Path& path) const {
-            ensure(m_loader != nullptr, "loader is null");
-            return m_loader->initializeModel(path, m_logger);
+        void EntityModelManager::startPendingLoads() const {
+            auto runningLoads = runningLoadCount();
+            for (auto& [path, task] : m_pendingModels) {
+                if (runningLoads >= m_maxConcurrentLoads) {
+                    break;
+                }
+                if (!task->started()) {
+                    task->start(*m_loader);
+                    ++runningLoads;
+                }
+            }
         }
 
         void EntityModelManager::loadFrame(const Assets::ModelSpecification& spec, Assets::EntityModel& model) const {
             try {
                 ensure(m_loader != nullptr, "loader is null");
                 m_loader->loadFrame(spec.path, spec.frameIndex, model, m_logger);
+                m_logger.debug() << "Loaded entity model frame " << spec << ", model now uses " << model.vertexDataSize() << " bytes of vertex data";
             } catch (const Exception& e) {
                 // FIXME: be specific about which exceptions to catch here
                 m_logger.error() << "Could not load entity model frame " << spec << ": " << e.what();
@@ -49,11 +49,19 @@ namespace TrenchBroom {
         class EntityModelFrame;
         struct ModelSpecification;
 
+        /**
+         * Manages the entity models and their renderers. Models are parsed asynchronously on a bounded number of
+         * background threads: while a model is being loaded, it is reported as missing and the entity is rendered as
+         * its bounding box. Finished models are picked up on the main thread by calling processLoadedModels().
+         */
         class EntityModelManager {
         private:
+            class ModelLoadTask;
+
             using ModelCache = std::map<IO::Path, std::unique_ptr<EntityModel>>;
             using ModelMismatches = kdl::vector_set<IO::Path>;
             using ModelList = std::vector<EntityModel*>;
+            using PendingModels = std::map<IO::Path, std::unique_ptr<ModelLoadTask>>;
 
             using RendererCache = std::map<ModelSpecification, std::unique_ptr<Renderer::TexturedRenderer>>;
             using RendererMismatches = kdl::vector_set<ModelSpecification>;
@@ -61,6 +69,7 @@ namespace TrenchBroom {
 
             Logger& m_logger;
             const IO::EntityModelLoader* m_loader;
+            size_t m_maxConcurrentLoads;
 
             int m_minFilter;
             int m_magFilter;
@@ -68,6 +77,7 @@ namespace TrenchBroom {
 
             mutable ModelCache m_models;
             mutable ModelMismatches m_modelMismatches;
+            mutable PendingModels m_pendingModels;
             mutable RendererCache m_renderers;
             mutable RendererMismatches m_rendererMismatches;
 
@@ -87,10 +97,31 @@ namespace TrenchBroom {
 
             bool hasModel(const Model::Entity* entity) const;
             bool hasModel(const ModelSpecification& spec) const;
+
+            /**
+             * Indicates whether any models are currently being loaded in the background.
+             */
+            bool hasPendingModels() const;
+
+            /**
+             * Waits for all models that are currently being loaded in the background and discards them together with
+             * all models that are waiting to be loaded. This must be called before the file system used by the loader
+             * is changed. The discarded models are requested again the next time they are accessed.
+             */
+            void cancelPendingLoads();
+
+            /**
+             * Moves all models that have finished loading in the background into the model cache. Must be called
+             * on the main thread.
+             *
+             * @return the paths of the models that have finished loading, including those that failed to load
+             */
+            std::vector<IO::Path> processLoadedModels();
         private:
-            EntityModel* model(const IO::Path& path) const;
-            EntityModel* safeGetModel(const IO::Path& path) const;
-            std::unique_ptr<EntityModel> loadModel(const IO::Path& path) const;
+            EntityModel* model(const ModelSpecification& spec) const;
+            void loadModel(const ModelSpecification& spec) const;
+            size_t runningLoadCount() const;
+            void startPendingLoads() const;
             void loadFrame(const ModelSpecification& spec, EntityModel& model) const;
         public:
             void prepare(Renderer::VboManager& vboManager);
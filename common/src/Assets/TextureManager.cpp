@@ -25,13 +25,17 @@
 #include "Assets/TextureCollection.h"
 #include "IO/TextureLoader.h"
 
+#include <kdl/compact_trie.h>
 #include <kdl/map_utils.h>
+#include <kdl/string_compare.h>
 #include <kdl/string_format.h>
 #include <kdl/vector_utils.h>
 
 #include <algorithm>
 #include <iterator>
+#include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace TrenchBroom {
@@ -65,6 +69,26 @@ namespace TrenchBroom {
             clear();
         }
 
+        static std::vector<Texture*> sortByName(const std::set<Texture*>& textures) {
+            auto result = std::vector<Texture*>(std::begin(textures), std::end(textures));
+            kdl::vec_sort(result, [](const Texture* lhs, const Texture* rhs) {
+                return kdl::ci::str_compare(lhs->name(), rhs->name()) < 0;
+            });
+            return result;
+        }
+
+        static std::string escapeGlob(const std::string& str) {
+            std::string result;
+            result.reserve(str.size());
+            for (const char c : str) {
+                if (c == '*' || c == '?' || c == '%' || c == '\\') {
+                    result.push_back('\\');
+                }
+                result.push_back(c);
+            }
+            return result;
+        }
+
         void TextureManager::setTextureCollections(const std::vector<IO::Path>& paths, IO::TextureLoader& loader) {
             auto collections = collectionMap();
             m_collections.clear();
@@ -128,7 +152,10 @@ namespace TrenchBroom {
 
             m_toPrepare.clear();
             m_texturesByName.clear();
+            m_texturesByInternedName.clear();
             m_textures.clear();
+            m_nameIndex.reset();
+            m_suffixIndex.reset();
 
             // Remove logging because it might fail when the document is already destroyed.
         }
@@ -146,7 +173,7 @@ namespace TrenchBroom {
         }
 
         Texture* TextureManager::texture(const std::string& name) const {
-            auto it = m_texturesByName.find(kdl::str_to_lower(name));
+            auto it = m_texturesByName.find(name);
             if (it == std::end(m_texturesByName)) {
                 return nullptr;
             } else {
@@ -154,10 +181,36 @@ namespace TrenchBroom {
             }
         }
 
+        Texture* TextureManager::texture(const InternedString& name) const {
+            auto it = m_texturesByInternedName.find(name.lowerCase());
+            if (it == std::end(m_texturesByInternedName)) {
+                return nullptr;
+            } else {
+                return it->second;
+            }
+        }
+
         const std::vector<Texture*>& TextureManager::textures() const {
             return m_textures;
         }
 
+        std::vector<Texture*> TextureManager::findTextures(const std::string& pattern) const {
+            std::set<Texture*> result;
+            nameIndex().find_matches(kdl::str_to_lower(pattern), std::inserter(result, std::end(result)));
+            return sortByName(result);
+        }
+
+        std::vector<Texture*> TextureManager::findTexturesContaining(const std::string& str) const {
+            if (str.empty()) {
+                return findTextures("*");
+            }
+
+            // every texture whose name contains str has a name suffix that starts with str
+            std::set<Texture*> result;
+            suffixIndex().find_matches(escapeGlob(kdl::str_to_lower(str)) + "*", std::inserter(result, std::end(result)));
+            return sortByName(result);
+        }
+
         const std::vector<TextureCollection*>& TextureManager::collections() const {
             return m_collections;
         }
@@ -186,24 +239,59 @@ namespace TrenchBroom {
 
         void TextureManager::updateTextures() {
             m_texturesByName.clear();
+            m_texturesByInternedName.clear();
             m_textures.clear();
+            m_nameIndex.reset();
+            m_suffixIndex.reset();
 
             for (auto* collection : m_collections) {
                 for (auto* texture : collection->textures()) {
-                    const auto key = kdl::str_to_lower(texture->name());
                     texture->setOverridden(false);
 
-                    auto mIt = m_texturesByName.find(key);
+                    auto mIt = m_texturesByName.find(texture->name());
                     if (mIt != std::end(m_texturesByName)) {
                         mIt->second->setOverridden(true);
                         mIt->second = texture;
                     } else {
-                        m_texturesByName.insert(std::make_pair(key, texture));
+                        m_texturesByName.insert(std::make_pair(texture->name(), texture));
                     }
                 }
             }
 
             m_textures = kdl::map_values(m_texturesByName);
+
+            m_texturesByInternedName.reserve(m_textures.size());
+            for (auto* texture : m_textures) {
+                m_texturesByInternedName.emplace(InternedString(texture->name()).lowerCase(), texture);
+            }
+        }
+
+        const TextureManager::TextureNameIndex& TextureManager::nameIndex() const {
+            if (m_nameIndex == nullptr) {
+                m_nameIndex = std::make_unique<TextureNameIndex>();
+                for (auto* collection : m_collections) {
+                    for (auto* texture : collection->textures()) {
+                        m_nameIndex->insert(kdl::str_to_lower(texture->name()), texture);
+                    }
+                }
+            }
+            return *m_nameIndex;
+        }
+
+        const TextureManager::TextureNameIndex& TextureManager::suffixIndex() const {
+            if (m_suffixIndex == nullptr) {
+                m_suffixIndex = std::make_unique<TextureNameIndex>();
+                for (auto* collection : m_collections) {
+                    for (auto* texture : collection->textures()) {
+                        const auto key = kdl::str_to_lower(texture->name());
+                        const auto keyView = std::string_view(key);
+                        for (size_t i = 0u; i < keyView.size(); ++i) {
+                            m_suffixIndex->insert(keyView.substr(i), texture);
+                        }
+                    }
+                }
+            }
+            return *m_suffixIndex;
         }
     }
 }
@@ -20,10 +20,16 @@
 #ifndef TrenchBroom_TextureManager
 #define TrenchBroom_TextureManager
 
+#include "InternedString.h"
 #include "Notifier.h"
 
+#include <kdl/compact_trie_forward.h>
+#include <kdl/string_compare.h>
+
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace TrenchBroom {
@@ -42,7 +48,11 @@ namespace TrenchBroom {
         private:
             using TextureCollectionMap = std::map<IO::Path, TextureCollection*>;
             using TextureCollectionMapEntry = std::pair<IO::Path, TextureCollection*>;
-            using TextureMap = std::map<std::string, Texture*>;
+            // compares case insensitively, so that looking up a texture does not require a lower case copy of its name
+            using TextureMap = std::map<std::string, Texture*, kdl::ci::string_less>;
+            using TextureNameIndex = kdl::compact_trie<Texture*>;
+            // maps the interned lower case names of the textures in m_texturesByName to the textures
+            using InternedTextureMap = std::unordered_map<InternedString, Texture*>;
 
             Logger& m_logger;
 
@@ -52,8 +62,13 @@ namespace TrenchBroom {
             std::vector<TextureCollection*> m_toRemove;
 
             TextureMap m_texturesByName;
+            InternedTextureMap m_texturesByInternedName;
             std::vector<Texture*> m_textures;
 
+            // search indices over the lower case names of all textures, built on demand
+            mutable std::unique_ptr<TextureNameIndex> m_nameIndex;
+            mutable std::unique_ptr<TextureNameIndex> m_suffixIndex;
+
             int m_minFilter;
             int m_magFilter;
             bool m_resetTextureMode;
@@ -75,7 +90,37 @@ namespace TrenchBroom {
             void commitChanges();
 
             Texture* texture(const std::string& name) const;
+
+            /**
+             * Returns the texture with the given name, ignoring case. This is faster than looking up a texture by a
+             * string because the lower case version of an interned string is cached.
+             *
+             * @param name the name of the texture
+             * @return the texture or nullptr if there is no texture with the given name
+             */
+            Texture* texture(const InternedString& name) const;
             const std::vector<Texture*>& textures() const;
+
+            /**
+             * Finds all textures whose names match the given glob pattern, ignoring case. See kdl::str_matches_glob for
+             * the pattern syntax. The result includes overridden textures and is sorted by name.
+             *
+             * @param pattern the pattern to match
+             * @return the matching textures
+             *
+             * @throws std::invalid_argument if the given pattern contains an invalid escape sequence
+             */
+            std::vector<Texture*> findTextures(const std::string& pattern) const;
+
+            /**
+             * Finds all textures whose names contain the given string, ignoring case. The result includes overridden
+             * textures and is sorted by name.
+             *
+             * @param str the string to search for
+             * @return the matching textures
+             */
+            std::vector<Texture*> findTexturesContaining(const std::string& str) const;
+
             const std::vector<TextureCollection*>& collections() const;
             const std::vector<std::string> collectionNames() const;
         private:
@@ -83,6 +128,9 @@ namespace TrenchBroom {
             void prepare();
 
             void updateTextures();
+
+            const TextureNameIndex& nameIndex() const;
+            const TextureNameIndex& suffixIndex() const;
         };
     }
 }
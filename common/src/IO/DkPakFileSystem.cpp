@@ -21,6 +21,7 @@
 
 #include "IO/DiskFileSystem.h"
 #include "IO/File.h"
+#include "IO/MountCache.h"
 #include "IO/Path.h"
 
 #include <kdl/string_format.h>
@@ -88,12 +89,12 @@ namespace TrenchBroom {
         DkPakFileSystem::DkPakFileSystem(const Path& path) :
         DkPakFileSystem(nullptr, path) {}
 
-        DkPakFileSystem::DkPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path) :
+        DkPakFileSystem::DkPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path, MountCache* mountCache) :
         ImageFileSystem(std::move(next), path) {
-            initialize();
+            initialize(mountCache);
         }
 
-        void DkPakFileSystem::doReadDirectory() {
+        std::vector<ArchiveEntry> DkPakFileSystem::doReadEntries() {
             auto reader = m_file->reader();
             reader.seekFromBegin(DkPakLayout::HeaderMagicLength);
 
@@ -103,6 +104,9 @@ namespace TrenchBroom {
 
             reader.seekFromBegin(directoryAddress);
 
+            std::vector<ArchiveEntry> result;
+            result.reserve(entryCount);
+
             for (size_t i = 0; i < entryCount; ++i) {
                 const auto entryName = reader.readString(DkPakLayout::EntryNameLength);
                 const auto entryAddress = reader.readSize<int32_t>();
@@ -111,14 +115,19 @@ namespace TrenchBroom {
                 const auto compressed = reader.readBool<int32_t>();
                 const auto entrySize = compressed ? compressedSize : uncompressedSize;
 
-                const auto entryPath = Path(kdl::str_to_lower(entryName));
-                auto entryFile = std::make_shared<FileView>(entryPath, m_file, entryAddress, entrySize);
+                result.emplace_back(Path(kdl::str_to_lower(entryName)), entryAddress, entrySize, uncompressedSize, compressed);
+            }
 
-                if (compressed) {
-                    m_root.addFile(entryPath, std::make_unique<DkCompressedFile>(entryFile, uncompressedSize));
-                } else {
-                    m_root.addFile(entryPath, std::make_unique<SimpleFileEntry>(entryFile));
-                }
+            return result;
+        }
+
+        void DkPakFileSystem::doMountEntry(const ArchiveEntry& entry) {
+            auto entryFile = std::make_shared<FileView>(entry.path, m_file, entry.address, entry.size);
+
+            if (entry.compressed) {
+                m_root.addFile(entry.path, std::make_unique<DkCompressedFile>(entryFile, entry.uncompressedSize));
+            } else {
+                m_root.addFile(entry.path, std::make_unique<SimpleFileEntry>(entryFile));
             }
         }
     }
@@ -23,9 +23,11 @@
 #include "IO/ImageFileSystem.h"
 
 #include <memory>
+#include <vector>
 
 namespace TrenchBroom {
     namespace IO {
+        class MountCache;
         class Path;
 
         class DkPakFileSystem : public ImageFileSystem {
@@ -38,9 +40,10 @@ namespace TrenchBroom {
             };
         public:
             explicit DkPakFileSystem(const Path& path);
-            DkPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path);
+            DkPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path, MountCache* mountCache = nullptr);
         private:
-            void doReadDirectory() override;
+            std::vector<ArchiveEntry> doReadEntries() override;
+            void doMountEntry(const ArchiveEntry& entry) override;
 
         };
     }
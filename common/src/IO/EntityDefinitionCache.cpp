@@ -0,0 +1,115 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EntityDefinitionCache.h"
+
+#include "Exceptions.h"
+#include "Assets/EntityDefinition.h"
+#include "IO/DiskIO.h"
+#include "IO/File.h"
+#include "IO/Reader.h"
+
+#include <kdl/vector_utils.h>
+
+#include <functional>
+
+namespace TrenchBroom {
+    namespace IO {
+        EntityDefinitionCache::EntityDefinitionCache() = default;
+
+        EntityDefinitionCache::~EntityDefinitionCache() = default;
+
+        EntityDefinitionCache& EntityDefinitionCache::instance() {
+            static EntityDefinitionCache cache;
+            return cache;
+        }
+
+        std::optional<std::vector<Assets::EntityDefinition*>> EntityDefinitionCache::find(const Path& path, const std::string_view contents, const Color& defaultColor) const {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+
+            const auto it = m_entries.find(path);
+            if (it == std::end(m_entries)) {
+                return std::nullopt;
+            }
+
+            const auto& entry = it->second;
+            if (entry.defaultColor != defaultColor) {
+                return std::nullopt;
+            }
+
+            // the first file is the definition file itself
+            const auto fileHash = hashFile(path, contents);
+            const auto& cachedHash = entry.files.front();
+            if (fileHash.size != cachedHash.size || fileHash.hash != cachedHash.hash) {
+                return std::nullopt;
+            }
+
+            for (size_t i = 1u; i < entry.files.size(); ++i) {
+                const auto& includedHash = entry.files[i];
+                const auto currentHash = hashFile(includedHash.path);
+                if (!currentHash || currentHash->size != includedHash.size || currentHash->hash != includedHash.hash) {
+                    return std::nullopt;
+                }
+            }
+
+            return kdl::vec_transform(entry.definitions, [](const auto& definition) {
+                return definition->clone();
+            });
+        }
+
+        void EntityDefinitionCache::put(const Path& path, const std::string_view contents, const std::vector<Path>& includedPaths, const Color& defaultColor, const std::vector<Assets::EntityDefinition*>& definitions) {
+            auto entry = Entry{ defaultColor, { hashFile(path, contents) }, {} };
+            for (const auto& includedPath : includedPaths) {
+                const auto includedHash = hashFile(includedPath);
+                if (!includedHash) {
+                    // an included file cannot be read anymore, so the definitions cannot be validated later
+                    return;
+                }
+                entry.files.push_back(*includedHash);
+            }
+
+            entry.definitions.reserve(definitions.size());
+            for (const auto* definition : definitions) {
+                entry.definitions.emplace_back(definition->clone());
+            }
+
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_entries[path] = std::move(entry);
+        }
+
+        void EntityDefinitionCache::clear() {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_entries.clear();
+        }
+
+        EntityDefinitionCache::FileHash EntityDefinitionCache::hashFile(const Path& path, const std::string_view contents) {
+            return FileHash{ path, contents.size(), std::hash<std::string_view>()(contents) };
+        }
+
+        std::optional<EntityDefinitionCache::FileHash> EntityDefinitionCache::hashFile(const Path& path) {
+            try {
+                const auto file = Disk::openFile(path);
+                const auto reader = file->reader().buffer();
+                return hashFile(path, std::string_view(reader.begin(), reader.size()));
+            } catch (const Exception&) {
+                return std::nullopt;
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRENCHBROOM_ENTITYDEFINITIONCACHE_H
+#define TRENCHBROOM_ENTITYDEFINITIONCACHE_H
+
+#include "Color.h"
+#include "IO/Path.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Assets {
+        class EntityDefinition;
+    }
+
+    namespace IO {
+        /**
+         * Keeps the entity definitions parsed from definition files, so that a definition file which did not change
+         * does not have to be parsed again.
+         *
+         * The definitions of a file are identified by the path, the contents and the default entity color used to parse
+         * the file, and by the contents of all files it included. Callers receive copies of the stored definitions which
+         * they own, while the attribute definitions are shared.
+         */
+        class EntityDefinitionCache {
+        private:
+            struct FileHash {
+                Path path;
+                size_t size;
+                size_t hash;
+            };
+
+            struct Entry {
+                Color defaultColor;
+                std::vector<FileHash> files;
+                std::vector<std::unique_ptr<Assets::EntityDefinition>> definitions;
+            };
+
+            mutable std::mutex m_mutex;
+            std::map<Path, Entry> m_entries;
+        public:
+            EntityDefinitionCache();
+            ~EntityDefinitionCache();
+
+            /**
+             * The cache shared by all games.
+             */
+            static EntityDefinitionCache& instance();
+
+            /**
+             * Returns copies of the definitions stored for the file at the given path if they were parsed from the given
+             * contents with the given default color, and if none of the included files have changed since. Otherwise,
+             * returns an empty optional.
+             */
+            std::optional<std::vector<Assets::EntityDefinition*>> find(const Path& path, std::string_view contents, const Color& defaultColor) const;
+
+            /**
+             * Stores copies of the given definitions, which were parsed from the given contents of the file at the given
+             * path. The given included paths must be absolute.
+             */
+            void put(const Path& path, std::string_view contents, const std::vector<Path>& includedPaths, const Color& defaultColor, const std::vector<Assets::EntityDefinition*>& definitions);
+
+            void clear();
+        private:
+            static FileHash hashFile(const Path& path, std::string_view contents);
+            static std::optional<FileHash> hashFile(const Path& path);
+        };
+    }
+}
+
+#endif //TRENCHBROOM_ENTITYDEFINITIONCACHE_H
@@ -132,6 +132,7 @@ namespace TrenchBroom {
 
         FgdParser::FgdParser(const char* begin, const char* end, const Color& defaultEntityColor, const Path& path) :
         m_defaultEntityColor(defaultEntityColor),
+        m_includeFailed(false),
         m_tokenizer(FgdTokenizer(begin, end)) {
             if (!path.isEmpty()) {
                 pushIncludePath(path);
@@ -144,6 +145,14 @@ namespace TrenchBroom {
         FgdParser::FgdParser(const std::string& str, const Color& defaultEntityColor) :
         FgdParser(str, defaultEntityColor, Path()) {}
 
+        const std::vector<Path>& FgdParser::includedPaths() const {
+            return m_includedPaths;
+        }
+
+        bool FgdParser::includeFailed() const {
+            return m_includeFailed;
+        }
+
         FgdParser::TokenNameMap FgdParser::tokenNames() const {
             using namespace FgdToken;
 
@@ -721,6 +730,7 @@ namespace TrenchBroom {
 
                 if (!isRecursiveInclude(filePath)) {
                     const PushIncludePath pushIncludePath(this, filePath);
+                    m_includedPaths.push_back(filePath);
                     auto reader = file->reader().buffer();
                     m_tokenizer.replaceState(std::begin(reader), std::end(reader));
                     result = doParseDefinitions(status);
@@ -728,6 +738,7 @@ namespace TrenchBroom {
                     status.error(m_tokenizer.line(), kdl::str_to_string("Skipping recursively included file: ", path.asString(), " (", filePath, ")"));
                 }
             } catch (const Exception &e) {
+                m_includeFailed = true;
                 status.error(m_tokenizer.line(), kdl::str_to_string("Failed to parse included file: ", e.what()));
             }
 
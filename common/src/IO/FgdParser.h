@@ -75,6 +75,8 @@ namespace TrenchBroom {
             Color m_defaultEntityColor;
 
             std::vector<Path> m_paths;
+            std::vector<Path> m_includedPaths;
+            bool m_includeFailed;
             std::shared_ptr<FileSystem> m_fs;
 
             FgdTokenizer m_tokenizer;
@@ -83,6 +85,16 @@ namespace TrenchBroom {
             FgdParser(const char* begin, const char* end, const Color& defaultEntityColor, const Path& path);
             FgdParser(const std::string& str, const Color& defaultEntityColor, const Path& path);
             FgdParser(const std::string& str, const Color& defaultEntityColor);
+
+            /**
+             * Returns the absolute paths of all files that were included while parsing.
+             */
+            const std::vector<Path>& includedPaths() const;
+
+            /**
+             * Indicates whether any included file could not be opened or parsed.
+             */
+            bool includeFailed() const;
         private:
             class PushIncludePath;
             void pushIncludePath(const Path& path);
@@ -79,7 +79,7 @@ namespace TrenchBroom {
         }
 
         Reader CFile::reader() const {
-            return Reader::from(m_file);
+            return Reader::from(m_file, m_mutex);
         }
 
         size_t CFile::size() const {
@@ -25,6 +25,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <mutex>
 
 namespace TrenchBroom {
     namespace IO {
@@ -114,6 +115,8 @@ namespace TrenchBroom {
         private:
             std::FILE* m_file;
             size_t m_size;
+            // guards the position indicator of m_file, which is shared by all readers of this file
+            mutable std::mutex m_mutex;
         public:
             /**
              * Creates a new file with the given path and opens the file for reading.
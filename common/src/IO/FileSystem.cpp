@@ -22,13 +22,20 @@
 #include "Exceptions.h"
 #include "IO/FileMatcher.h"
 
+#include <kdl/string_format.h>
 #include <kdl/vector_utils.h>
 
+#include <cassert>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace TrenchBroom {
     namespace IO {
+        static std::string indexKey(const Path& path) {
+            return kdl::str_to_lower(path.makeCanonical().asString("/"));
+        }
+
         FileSystem::FileSystem(std::shared_ptr<FileSystem> next) :
         m_next(std::move(next)) {}
 
@@ -46,9 +53,59 @@ namespace TrenchBroom {
         }
 
         std::shared_ptr<FileSystem> FileSystem::releaseNext() {
+            clearIndex();
             return std::move(m_next);
         }
 
+        void FileSystem::buildIndex() {
+            clearIndex();
+
+            auto* fs = this;
+            while (fs != nullptr) {
+                if (!fs->doCanIndex()) {
+                    fs = fs->m_next.get();
+                    continue;
+                }
+
+                auto* first = fs;
+                auto index = std::make_unique<Index>();
+
+                // the file systems are visited in chain order, so that the first one containing a path owns it
+                for (; fs != nullptr && fs->doCanIndex(); fs = fs->m_next.get()) {
+                    if (fs->doDirectoryExists(Path())) {
+                        auto& root = index->entries[indexKey(Path())];
+                        if (root.owner == nullptr) {
+                            root.owner = fs;
+                        }
+                        root.directory = true;
+                        fs->indexDirectory(Path(), *index);
+                    }
+                }
+
+                for (auto& entry : index->entries) {
+                    kdl::vec_sort(entry.second.contents);
+                }
+
+                index->next = fs;
+                first->m_index = std::move(index);
+            }
+        }
+
+        void FileSystem::clearIndex() {
+            for (auto* fs = this; fs != nullptr; fs = fs->m_next.get()) {
+                fs->m_index.reset();
+            }
+        }
+
+        bool FileSystem::hasIndex() const {
+            for (const auto* fs = this; fs != nullptr; fs = fs->m_next.get()) {
+                if (fs->m_index) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         bool FileSystem::canMakeAbsolute(const Path& path) const {
             return !path.isAbsolute();
         }
@@ -144,6 +201,14 @@ namespace TrenchBroom {
         }
 
         Path FileSystem::_makeAbsolute(const Path& path) const {
+            if (m_index) {
+                const auto* entry = findIndexEntry(path);
+                if (entry != nullptr) {
+                    return entry->owner->doMakeAbsolute(path);
+                }
+                return m_index->next ? m_index->next->_makeAbsolute(path) : Path();
+            }
+
             if (doFileExists(path) || doDirectoryExists(path)) {
                 // If the file is present in this file system, make it absolute here.
                 return doMakeAbsolute(path);
@@ -158,17 +223,39 @@ namespace TrenchBroom {
         }
 
         bool FileSystem::_directoryExists(const Path& path) const {
+            if (m_index) {
+                const auto* entry = findIndexEntry(path);
+                return (entry != nullptr && entry->directory) || (m_index->next && m_index->next->_directoryExists(path));
+            }
+
             return doDirectoryExists(path) || (m_next && m_next->_directoryExists(path)) ;
         }
 
         bool FileSystem::_fileExists(const Path& path) const {
+            if (m_index) {
+                const auto* entry = findIndexEntry(path);
+                return (entry != nullptr && entry->fileOwner != nullptr) || (m_index->next && m_index->next->_fileExists(path));
+            }
+
             return doFileExists(path) || (m_next && m_next->_fileExists(path));
         }
 
         std::vector<Path> FileSystem::_getDirectoryContents(const Path& directoryPath) const {
-            auto result = doGetDirectoryContents(directoryPath);
-            if (m_next) {
-                kdl::vec_append(result, m_next->_getDirectoryContents(directoryPath));
+            auto result = std::vector<Path>();
+            const FileSystem* next = nullptr;
+            if (m_index) {
+                const auto* entry = findIndexEntry(directoryPath);
+                if (entry != nullptr) {
+                    result = entry->contents;
+                }
+                next = m_index->next;
+            } else {
+                result = doGetDirectoryContents(directoryPath);
+                next = m_next.get();
+            }
+
+            if (next) {
+                kdl::vec_append(result, next->_getDirectoryContents(directoryPath));
             }
 
             kdl::vec_sort_and_remove_duplicates(result);
@@ -176,6 +263,17 @@ namespace TrenchBroom {
         }
 
         std::shared_ptr<File> FileSystem::_openFile(const Path& path) const {
+            if (m_index) {
+                const auto* entry = findIndexEntry(path);
+                if (entry != nullptr && entry->fileOwner != nullptr) {
+                    return entry->fileOwner->doOpenFile(path);
+                } else if (m_index->next) {
+                    return m_index->next->_openFile(path);
+                } else {
+                    throw FileSystemException("File not found: '" + path.asString() + "'");
+                }
+            }
+
             if (doFileExists(path)) {
                 return doOpenFile(path);
             } else if (m_next) {
@@ -185,6 +283,40 @@ namespace TrenchBroom {
             }
         }
 
+        const FileSystem::IndexEntry* FileSystem::findIndexEntry(const Path& path) const {
+            assert(m_index);
+            const auto it = m_index->entries.find(indexKey(path));
+            return it != std::end(m_index->entries) ? &it->second : nullptr;
+        }
+
+        void FileSystem::indexDirectory(const Path& path, Index& index) const {
+            for (const auto& itemPath : doGetDirectoryContents(path)) {
+                const auto key = indexKey(path + itemPath);
+                const auto directory = doDirectoryExists(path + itemPath);
+                const auto file = !directory && doFileExists(path + itemPath);
+
+                if (index.entries.count(key) == 0u) {
+                    index.entries[indexKey(path)].contents.push_back(itemPath);
+                }
+
+                auto& entry = index.entries[key];
+                if (entry.owner == nullptr) {
+                    entry.owner = this;
+                }
+                if (file && entry.fileOwner == nullptr) {
+                    entry.fileOwner = this;
+                }
+                if (directory) {
+                    entry.directory = true;
+                    indexDirectory(path + itemPath, index);
+                }
+            }
+        }
+
+        bool FileSystem::doCanIndex() const {
+            return false;
+        }
+
         bool FileSystem::doCanMakeAbsolute(const Path& /* path */) const {
             return false;
         }
@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace TrenchBroom {
@@ -48,6 +49,28 @@ namespace TrenchBroom {
              * so std::unique_ptr isn't usable with this design.)
              */
             std::shared_ptr<FileSystem> m_next;
+        private:
+            struct IndexEntry {
+                /** The first file system in the chain that contains a file or a directory at this path. */
+                const FileSystem* owner = nullptr;
+                /** The first file system in the chain that contains a file at this path. */
+                const FileSystem* fileOwner = nullptr;
+                bool directory = false;
+                /** The names of the items in this directory, merged over all file systems in the chain. */
+                std::vector<Path> contents;
+            };
+
+            /**
+             * Indexes a run of consecutive file systems in the chain which can be indexed, see doCanIndex. The index is
+             * stored in the first file system of the run.
+             */
+            struct Index {
+                /** Maps lower case paths to their entries. */
+                std::unordered_map<std::string, IndexEntry> entries;
+                /** The file system following the run, or nullptr if the run ends the chain. */
+                const FileSystem* next = nullptr;
+            };
+            std::unique_ptr<Index> m_index;
         public: // public API
             explicit FileSystem(std::shared_ptr<FileSystem> next = std::shared_ptr<FileSystem>());
             virtual ~FileSystem();
@@ -56,6 +79,27 @@ namespace TrenchBroom {
             const FileSystem& next() const;
             std::shared_ptr<FileSystem> releaseNext();
 
+            /**
+             * Indexes the files and directories of the file systems in this chain whose contents do not change once
+             * they are mounted, such as archives. Every run of consecutive such file systems is indexed as a whole, so
+             * that queries skip the entire run with a single lookup instead of asking each file system in turn. Other
+             * file systems, such as directories on disk, are still asked directly, so files that are added to them are
+             * found without rebuilding the index.
+             *
+             * The index must be rebuilt whenever the chain is modified or an indexed file system is reloaded.
+             */
+            void buildIndex();
+
+            /**
+             * Discards the indices built by `buildIndex`, if any.
+             */
+            void clearIndex();
+
+            /**
+             * Indicates whether any file system in this chain has an index.
+             */
+            bool hasIndex() const;
+
             bool canMakeAbsolute(const Path& path) const;
             Path makeAbsolute(const Path& path) const;
 
@@ -169,9 +213,16 @@ namespace TrenchBroom {
              */
             template <class M>
             void _findItems(const Path& searchPath, const M& matcher, const bool recurse, std::vector<Path>& result) const {
-                doFindItems(searchPath, matcher, recurse, result);
-                if (m_next) {
-                    m_next->_findItems(searchPath, matcher, recurse, result);
+                if (m_index) {
+                    findIndexedItems(searchPath, matcher, recurse, result);
+                    if (m_index->next) {
+                        m_index->next->_findItems(searchPath, matcher, recurse, result);
+                    }
+                } else {
+                    doFindItems(searchPath, matcher, recurse, result);
+                    if (m_next) {
+                        m_next->_findItems(searchPath, matcher, recurse, result);
+                    }
                 }
             }
 
@@ -199,7 +250,43 @@ namespace TrenchBroom {
                     }
                 }
             }
+
+            /**
+             * Finds all items matching the given matcher at the given search path, optionally recursively, and adds
+             * the matches to the given result. The items are looked up in the index of this file system, which must exist,
+             * so only the file systems in the indexed run are searched.
+             *
+             * @tparam M the matcher type
+             * @param searchPath the search path at which to search for matches
+             * @param matcher the matcher to apply to candidates
+             * @param recurse whether or not to recurse into sub directories
+             * @param result collects the matching paths
+             */
+            template <class M>
+            void findIndexedItems(const Path& searchPath, const M& matcher, const bool recurse, std::vector<Path>& result) const {
+                const auto* entry = findIndexEntry(searchPath);
+                if (entry != nullptr && entry->directory) {
+                    for (const auto& itemPath : entry->contents) {
+                        const auto* itemEntry = findIndexEntry(searchPath + itemPath);
+                        const auto directory = itemEntry != nullptr && itemEntry->directory;
+                        if (directory && recurse) {
+                            findIndexedItems(searchPath + itemPath, matcher, recurse, result);
+                        }
+                        if (matcher(searchPath + itemPath, directory)) {
+                            result.push_back(searchPath + itemPath);
+                        }
+                    }
+                }
+            }
+
+            const IndexEntry* findIndexEntry(const Path& path) const;
+            void indexDirectory(const Path& path, Index& index) const;
         private: // subclassing API
+            /**
+             * Indicates whether the contents of this file system are fixed once it is mounted, so that they can be
+             * indexed by `buildIndex`.
+             */
+            virtual bool doCanIndex() const;
             virtual bool doCanMakeAbsolute(const Path& path) const;
             virtual Path doMakeAbsolute(const Path& path) const;
 
@@ -20,6 +20,7 @@
 #include "IdPakFileSystem.h"
 
 #include "IO/File.h"
+#include "IO/MountCache.h"
 #include "IO/Reader.h"
 #include "IO/DiskFileSystem.h"
 
@@ -41,12 +42,12 @@ namespace TrenchBroom {
         IdPakFileSystem::IdPakFileSystem(const Path& path) :
         IdPakFileSystem(nullptr, path) {}
 
-        IdPakFileSystem::IdPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path) :
+        IdPakFileSystem::IdPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path, MountCache* mountCache) :
         ImageFileSystem(std::move(next), path) {
-            initialize();
+            initialize(mountCache);
         }
 
-        void IdPakFileSystem::doReadDirectory() {
+        std::vector<ArchiveEntry> IdPakFileSystem::doReadEntries() {
             char magic[PakLayout::HeaderMagicLength];
 
             auto reader = m_file->reader();
@@ -59,15 +60,23 @@ namespace TrenchBroom {
 
             reader.seekFromBegin(directoryAddress);
 
+            std::vector<ArchiveEntry> result;
+            result.reserve(entryCount);
+
             for (size_t i = 0; i < entryCount; ++i) {
                 const auto entryName = reader.readString(PakLayout::EntryNameLength);
                 const auto entryAddress = reader.readSize<int32_t>();
                 const auto entrySize = reader.readSize<int32_t>();
 
-                const auto entryPath = Path(kdl::str_to_lower(entryName));
-                auto entryFile = std::make_shared<FileView>(entryPath, m_file, entryAddress, entrySize);
-                m_root.addFile(entryPath, entryFile);
+                result.emplace_back(Path(kdl::str_to_lower(entryName)), entryAddress, entrySize);
             }
+
+            return result;
+        }
+
+        void IdPakFileSystem::doMountEntry(const ArchiveEntry& entry) {
+            auto entryFile = std::make_shared<FileView>(entry.path, m_file, entry.address, entry.size);
+            m_root.addFile(entry.path, entryFile);
         }
     }
 }
@@ -23,17 +23,20 @@
 #include "IO/ImageFileSystem.h"
 
 #include <memory>
+#include <vector>
 
 namespace TrenchBroom {
     namespace IO {
+        class MountCache;
         class Path;
 
         class IdPakFileSystem : public ImageFileSystem {
         public:
             explicit IdPakFileSystem(const Path& path);
-            IdPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path);
+            IdPakFileSystem(std::shared_ptr<FileSystem> next, const Path& path, MountCache* mountCache = nullptr);
         private:
-            void doReadDirectory() override;
+            std::vector<ArchiveEntry> doReadEntries() override;
+            void doMountEntry(const ArchiveEntry& entry) override;
         };
     }
 }
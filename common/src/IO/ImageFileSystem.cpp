@@ -22,6 +22,7 @@
 #include "Ensure.h"
 #include "IO/DiskFileSystem.h"
 #include "IO/File.h"
+#include "IO/MountCache.h"
 
 #include <cassert>
 #include <memory>
@@ -177,6 +178,11 @@ namespace TrenchBroom {
             initialize();
         }
 
+        bool ImageFileSystemBase::doCanIndex() const {
+            // the contents only change when the file system is reloaded
+            return true;
+        }
+
         bool ImageFileSystemBase::doDirectoryExists(const Path& path) const {
             const auto searchPath = path.makeLowerCase().makeCanonical();
             return m_root.directoryExists(searchPath);
@@ -199,9 +205,41 @@ namespace TrenchBroom {
         }
 
         ImageFileSystem::ImageFileSystem(std::shared_ptr<FileSystem> next, const Path& path) :
+        ImageFileSystem(std::move(next), path, std::make_shared<CFile>(path)) {}
+
+        ImageFileSystem::ImageFileSystem(std::shared_ptr<FileSystem> next, const Path& path, std::shared_ptr<CFile> file) :
         ImageFileSystemBase(std::move(next), path),
-        m_file(std::make_shared<CFile>(path)) {
+        m_file(std::move(file)) {
             ensure(m_path.isAbsolute(), "path must be absolute");
         }
+
+        void ImageFileSystem::initialize(MountCache* mountCache) {
+            if (mountCache == nullptr) {
+                ImageFileSystemBase::initialize();
+                return;
+            }
+
+            try {
+                if (const auto* entries = mountCache->find(m_path)) {
+                    mountEntries(*entries);
+                } else {
+                    auto newEntries = doReadEntries();
+                    mountEntries(newEntries);
+                    mountCache->put(m_path, std::move(newEntries));
+                }
+            } catch (const std::exception& e) {
+                throw FileSystemException("Could not initialize image file system '" + m_path.asString() + "': " + e.what());
+            }
+        }
+
+        void ImageFileSystem::doReadDirectory() {
+            mountEntries(doReadEntries());
+        }
+
+        void ImageFileSystem::mountEntries(const std::vector<ArchiveEntry>& entries) {
+            for (const auto& entry : entries) {
+                doMountEntry(entry);
+            }
+        }
     }
 }
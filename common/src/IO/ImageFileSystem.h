@@ -27,11 +27,14 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace TrenchBroom {
     namespace IO {
+        struct ArchiveEntry;
         class CFile;
         class File;
+        class MountCache;
 
         class ImageFileSystemBase : public FileSystem {
         protected:
@@ -103,6 +106,7 @@ namespace TrenchBroom {
              */
             void reload();
         private:
+            bool doCanIndex() const override;
             bool doDirectoryExists(const Path& path) const override;
             bool doFileExists(const Path& path) const override;
 
@@ -112,11 +116,34 @@ namespace TrenchBroom {
             virtual void doReadDirectory() = 0;
         };
 
+        /**
+         * An image file system that is backed by an archive file on disk.
+         *
+         * Subclasses read the archive's directory into a list of entries, which can be stored in a mount cache and
+         * mounted from there the next time, provided the archive file did not change.
+         */
         class ImageFileSystem : public ImageFileSystemBase {
         protected:
+            /**
+             * The archive file, or null if the subclass opens the archive file itself.
+             */
             std::shared_ptr<CFile> m_file;
         protected:
             ImageFileSystem(std::shared_ptr<FileSystem> next, const Path& path);
+            ImageFileSystem(std::shared_ptr<FileSystem> next, const Path& path, std::shared_ptr<CFile> file);
+
+            /**
+             * Mounts the archive's entries from the given cache if it contains them. Otherwise, the entries are read
+             * from the archive and stored in the cache. If the given cache is null, the entries are always read from
+             * the archive.
+             */
+            void initialize(MountCache* mountCache);
+        private:
+            void doReadDirectory() override;
+            void mountEntries(const std::vector<ArchiveEntry>& entries);
+
+            virtual std::vector<ArchiveEntry> doReadEntries() = 0;
+            virtual void doMountEntry(const ArchiveEntry& entry) = 0;
         };
     }
 }
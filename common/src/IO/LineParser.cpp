@@ -0,0 +1,193 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineParser.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace TrenchBroom {
+    namespace IO {
+        static bool isDigit(const char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        static bool isWhitespace(const char c) {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        LineParser::LineParser(const std::string_view line) :
+        m_cur(line.data()),
+        m_end(line.data() + line.size()) {}
+
+        bool LineParser::eol() {
+            skipWhitespace();
+            return m_cur == m_end;
+        }
+
+        bool LineParser::consume(const char c) {
+            skipWhitespace();
+            if (m_cur < m_end && *m_cur == c) {
+                ++m_cur;
+                return true;
+            }
+            return false;
+        }
+
+        std::optional<long> LineParser::parseInteger() {
+            skipWhitespace();
+
+            auto* cur = m_cur;
+            const auto negative = cur < m_end && *cur == '-';
+            if (cur < m_end && (*cur == '-' || *cur == '+')) {
+                ++cur;
+            }
+
+            if (cur == m_end || !isDigit(*cur)) {
+                return std::nullopt;
+            }
+
+            constexpr auto MaxValue = std::numeric_limits<long>::max();
+
+            long value = 0;
+            while (cur < m_end && isDigit(*cur)) {
+                const auto digit = static_cast<long>(*cur - '0');
+                if (value > (MaxValue - digit) / 10) {
+                    // the number does not fit, leave it unconsumed
+                    return std::nullopt;
+                }
+                value = value * 10 + digit;
+                ++cur;
+            }
+
+            m_cur = cur;
+            return negative ? -value : value;
+        }
+
+        std::optional<float> LineParser::parseFloat() {
+            // more digits than this are ignored, but still affect the exponent
+            constexpr auto MaxMantissa = std::uint64_t(1) << 59u;
+
+            skipWhitespace();
+
+            auto* cur = m_cur;
+            const auto negative = cur < m_end && *cur == '-';
+            if (cur < m_end && (*cur == '-' || *cur == '+')) {
+                ++cur;
+            }
+
+            std::uint64_t mantissa = 0u;
+            int exponent = 0;
+            auto digits = false;
+
+            while (cur < m_end && isDigit(*cur)) {
+                if (mantissa < MaxMantissa) {
+                    mantissa = mantissa * 10u + static_cast<std::uint64_t>(*cur - '0');
+                } else {
+                    ++exponent;
+                }
+                digits = true;
+                ++cur;
+            }
+
+            if (cur < m_end && *cur == '.') {
+                ++cur;
+                while (cur < m_end && isDigit(*cur)) {
+                    if (mantissa < MaxMantissa) {
+                        mantissa = mantissa * 10u + static_cast<std::uint64_t>(*cur - '0');
+                        --exponent;
+                    }
+                    digits = true;
+                    ++cur;
+                }
+            }
+
+            if (!digits) {
+                return std::nullopt;
+            }
+
+            if (cur < m_end && (*cur == 'e' || *cur == 'E')) {
+                auto* exp = cur + 1;
+                const auto negativeExp = exp < m_end && *exp == '-';
+                if (exp < m_end && (*exp == '-' || *exp == '+')) {
+                    ++exp;
+                }
+
+                // an 'e' that is not followed by an exponent is not part of the number
+                if (exp < m_end && isDigit(*exp)) {
+                    int value = 0;
+                    while (exp < m_end && isDigit(*exp)) {
+                        if (value < 10000) {
+                            value = value * 10 + (*exp - '0');
+                        }
+                        ++exp;
+                    }
+                    exponent += negativeExp ? -value : value;
+                    cur = exp;
+                }
+            }
+
+            // computing in double precision yields the correctly rounded float for all but pathological inputs
+            auto value = static_cast<double>(mantissa);
+            if (exponent < 0) {
+                value /= std::pow(10.0, -exponent);
+            } else if (exponent > 0) {
+                value *= std::pow(10.0, exponent);
+            }
+
+            m_cur = cur;
+            return static_cast<float>(negative ? -value : value);
+        }
+
+        void LineParser::skipWhitespace() {
+            while (m_cur < m_end && isWhitespace(*m_cur)) {
+                ++m_cur;
+            }
+        }
+
+        std::optional<std::string_view> nextLine(std::string_view& text) {
+            if (text.empty()) {
+                return std::nullopt;
+            }
+
+            const auto newline = text.find('\n');
+            auto line = text.substr(0u, newline);
+            text.remove_prefix(newline == std::string_view::npos ? text.size() : newline + 1u);
+
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1u);
+            }
+            return line;
+        }
+
+        std::vector<std::string_view> nextLines(std::string_view& text, const std::size_t count) {
+            std::vector<std::string_view> result;
+            while (result.size() < count) {
+                const auto line = nextLine(text);
+                if (!line) {
+                    break;
+                }
+                result.push_back(*line);
+            }
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRENCHBROOM_LINEPARSER_H
+#define TRENCHBROOM_LINEPARSER_H
+
+#include <kdl/parallel.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace IO {
+        /**
+         * Parses whitespace separated integers and decimal numbers from a single line of text without allocating
+         * memory. Unlike the tokenizers used by the map and entity definition parsers, this does not keep track of
+         * line and column numbers, which makes it suitable for large files with a trivial line based syntax, such as
+         * portal files and point files.
+         *
+         * Number parsing does not depend on the current locale.
+         */
+        class LineParser {
+        private:
+            const char* m_cur;
+            const char* m_end;
+        public:
+            explicit LineParser(std::string_view line);
+
+            /**
+             * Indicates whether only whitespace remains in the line.
+             */
+            bool eol();
+
+            /**
+             * Skips any whitespace and then the given character if it is next. Returns true if the character was
+             * skipped and false otherwise.
+             */
+            bool consume(char c);
+
+            /**
+             * Skips any whitespace and parses an integer with an optional sign. Returns an empty optional if the line
+             * does not continue with an integer or if the integer does not fit into a long, in which case the position
+             * is unchanged.
+             */
+            std::optional<long> parseInteger();
+
+            /**
+             * Skips any whitespace and parses a decimal number with an optional sign, an optional fraction and an
+             * optional exponent. Returns an empty optional if the line does not continue with a number, in which case
+             * the position is unchanged.
+             */
+            std::optional<float> parseFloat();
+        private:
+            void skipWhitespace();
+        };
+
+        /**
+         * Removes the first line from the given text and returns it without its line terminator, which may be "\n" or
+         * "\r\n". Returns an empty optional if the given text is empty.
+         */
+        std::optional<std::string_view> nextLine(std::string_view& text);
+
+        /**
+         * Removes up to the given number of lines from the given text and returns them as by nextLine. Pass the
+         * maximum value of std::size_t to return all remaining lines.
+         */
+        std::vector<std::string_view> nextLines(std::string_view& text, std::size_t count);
+
+        /**
+         * Applies the given function to every given line in parallel and returns the results in the order of the
+         * lines. The lines are distributed over the worker threads in chunks so that the overhead of scheduling a line
+         * is negligible compared to parsing it.
+         *
+         * @tparam F the type of the function to apply, must be callable with a std::string_view and safe to call
+         * concurrently
+         * @param lines the lines to parse
+         * @param parseLine the function to apply
+         * @return the results
+         */
+        template <typename F>
+        auto parseLines(const std::vector<std::string_view>& lines, const F& parseLine) {
+            constexpr std::size_t ChunkSize = 1024u;
+
+            using T = decltype(parseLine(std::string_view()));
+            auto result = std::vector<T>(lines.size());
+
+            const auto chunkCount = (lines.size() + ChunkSize - 1u) / ChunkSize;
+            kdl::parallel_for(chunkCount, [&](const std::size_t chunk) {
+                const auto first = chunk * ChunkSize;
+                const auto last = std::min(first + ChunkSize, lines.size());
+                for (auto i = first; i < last; ++i) {
+                    result[i] = parseLine(lines[i]);
+                }
+            });
+
+            return result;
+        }
+    }
+}
+
+#endif //TRENCHBROOM_LINEPARSER_H
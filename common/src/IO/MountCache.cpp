@@ -0,0 +1,224 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MountCache.h"
+
+#include "Exceptions.h"
+#include "IO/DiskIO.h"
+#include "IO/File.h"
+#include "IO/PathQt.h"
+#include "IO/Reader.h"
+#include "IO/ReaderException.h"
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+namespace TrenchBroom {
+    namespace IO {
+        namespace MountCacheLayout {
+            static const std::string Magic = "TBMC";
+            static const uint32_t Version = 1;
+        }
+
+        ArchiveEntry::ArchiveEntry(const Path& i_path, const size_t i_address, const size_t i_size) :
+        ArchiveEntry(i_path, i_address, i_size, i_size, false) {}
+
+        ArchiveEntry::ArchiveEntry(const Path& i_path, const size_t i_address, const size_t i_size, const size_t i_uncompressedSize, const bool i_compressed) :
+        path(i_path),
+        address(i_address),
+        size(i_size),
+        uncompressedSize(i_uncompressedSize),
+        compressed(i_compressed) {}
+
+        bool operator==(const ArchiveEntry& lhs, const ArchiveEntry& rhs) {
+            return lhs.path == rhs.path &&
+                   lhs.address == rhs.address &&
+                   lhs.size == rhs.size &&
+                   lhs.uncompressedSize == rhs.uncompressedSize &&
+                   lhs.compressed == rhs.compressed;
+        }
+
+        bool operator!=(const ArchiveEntry& lhs, const ArchiveEntry& rhs) {
+            return !(lhs == rhs);
+        }
+
+        template <typename T>
+        static void writeValue(std::ostream& stream, const T value) {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        static void writeString(std::ostream& stream, const std::string& str) {
+            writeValue<uint64_t>(stream, static_cast<uint64_t>(str.size()));
+            stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+        }
+
+        static std::string readString(Reader& reader) {
+            const auto size = reader.readSize<uint64_t>();
+            if (!reader.canRead(size)) {
+                throw ReaderException("String length exceeds file size");
+            }
+
+            auto result = std::string(size, '\0');
+            reader.read(result.data(), size);
+            return result;
+        }
+
+        MountCache::MountCache() :
+        m_modified(false) {}
+
+        MountCache MountCache::read(const Path& path) {
+            auto result = MountCache();
+            if (!Disk::fileExists(path)) {
+                return result;
+            }
+
+            try {
+                const auto file = Disk::openFile(path);
+                auto reader = file->reader().buffer();
+
+                if (reader.readString(MountCacheLayout::Magic.size()) != MountCacheLayout::Magic ||
+                    reader.read<uint32_t, uint32_t>() != MountCacheLayout::Version) {
+                    return result;
+                }
+
+                const auto archiveCount = reader.readSize<uint64_t>();
+                for (size_t i = 0u; i < archiveCount; ++i) {
+                    const auto archivePath = Path(readString(reader));
+
+                    auto archive = Archive();
+                    archive.stamp.size = reader.read<uint64_t, uint64_t>();
+                    archive.stamp.modificationTime = reader.read<int64_t, int64_t>();
+
+                    const auto entryCount = reader.readSize<uint64_t>();
+                    for (size_t j = 0u; j < entryCount; ++j) {
+                        const auto entryPath = Path(readString(reader));
+                        const auto address = reader.readSize<uint64_t>();
+                        const auto size = reader.readSize<uint64_t>();
+                        const auto uncompressedSize = reader.readSize<uint64_t>();
+                        const auto compressed = reader.readBool<uint8_t>();
+                        archive.entries.emplace_back(entryPath, address, size, uncompressedSize, compressed);
+                    }
+
+                    if (Disk::fileExists(archivePath)) {
+                        // the archive is pruned on the next write unless it is mounted in the meantime
+                        archive.used = false;
+                        result.m_archives.emplace(archivePath, std::move(archive));
+                    } else {
+                        result.m_modified = true;
+                    }
+                }
+            } catch (const Exception&) {
+                // a damaged cache is discarded and rebuilt
+                return MountCache();
+            }
+
+            return result;
+        }
+
+        void MountCache::write(const Path& path) const {
+            Disk::ensureDirectoryExists(path.deleteLastComponent());
+
+            const auto usedArchiveCount = static_cast<size_t>(std::count_if(std::begin(m_archives), std::end(m_archives), [](const auto& entry) {
+                return entry.second.used;
+            }));
+
+            std::ostringstream stream(std::ios::out | std::ios::binary);
+            stream.write(MountCacheLayout::Magic.data(), static_cast<std::streamsize>(MountCacheLayout::Magic.size()));
+            writeValue<uint32_t>(stream, MountCacheLayout::Version);
+            writeValue<uint64_t>(stream, static_cast<uint64_t>(usedArchiveCount));
+
+            for (const auto& [archivePath, archive] : m_archives) {
+                if (!archive.used) {
+                    continue;
+                }
+
+                writeString(stream, archivePath.asString("/"));
+                writeValue<uint64_t>(stream, archive.stamp.size);
+                writeValue<int64_t>(stream, archive.stamp.modificationTime);
+
+                writeValue<uint64_t>(stream, static_cast<uint64_t>(archive.entries.size()));
+                for (const auto& entry : archive.entries) {
+                    writeString(stream, entry.path.asString("/"));
+                    writeValue<uint64_t>(stream, static_cast<uint64_t>(entry.address));
+                    writeValue<uint64_t>(stream, static_cast<uint64_t>(entry.size));
+                    writeValue<uint64_t>(stream, static_cast<uint64_t>(entry.uncompressedSize));
+                    writeValue<uint8_t>(stream, entry.compressed ? 1u : 0u);
+                }
+            }
+
+            // write to a temporary file which replaces the cache file once it is complete, so that a failed write does not
+            // leave a truncated cache behind
+            const auto data = stream.str();
+            QSaveFile saveFile(pathAsQString(path));
+            if (!saveFile.open(QIODevice::WriteOnly) ||
+                saveFile.write(data.data(), static_cast<qint64>(data.size())) != static_cast<qint64>(data.size()) ||
+                !saveFile.commit()) {
+                throw FileSystemException("Could not write mount cache file: '" + path.asString() + "'");
+            }
+        }
+
+        bool MountCache::modified() const {
+            return m_modified || std::any_of(std::begin(m_archives), std::end(m_archives), [](const auto& entry) {
+                return !entry.second.used;
+            });
+        }
+
+        size_t MountCache::archiveCount() const {
+            return m_archives.size();
+        }
+
+        const std::vector<ArchiveEntry>* MountCache::find(const Path& archivePath) const {
+            const auto it = m_archives.find(archivePath);
+            if (it == std::end(m_archives)) {
+                return nullptr;
+            }
+
+            const auto& archive = it->second;
+            const auto currentStamp = stamp(archivePath);
+            if (archive.stamp.size != currentStamp.size || archive.stamp.modificationTime != currentStamp.modificationTime) {
+                return nullptr;
+            }
+
+            archive.used = true;
+            return &archive.entries;
+        }
+
+        void MountCache::put(const Path& archivePath, std::vector<ArchiveEntry> entries) {
+            m_archives[archivePath] = Archive{ stamp(archivePath), std::move(entries), true };
+            m_modified = true;
+        }
+
+        MountCache::FileStamp MountCache::stamp(const Path& archivePath) {
+            const auto fileInfo = QFileInfo(pathAsQString(archivePath));
+            if (!fileInfo.exists()) {
+                return FileStamp{ 0u, 0 };
+            }
+
+            return FileStamp{
+                static_cast<uint64_t>(fileInfo.size()),
+                static_cast<int64_t>(fileInfo.lastModified().toMSecsSinceEpoch())
+            };
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRENCHBROOM_MOUNTCACHE_H
+#define TRENCHBROOM_MOUNTCACHE_H
+
+#include "IO/Path.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace IO {
+        /**
+         * A file stored in an archive, as listed by the archive's directory.
+         *
+         * The meaning of the address depends on the archive format, e.g. it is the offset of the file data in a PAK or
+         * WAD file, but the index of the file in a ZIP archive.
+         */
+        struct ArchiveEntry {
+            Path path;
+            size_t address;
+            size_t size;
+            size_t uncompressedSize;
+            bool compressed;
+
+            ArchiveEntry(const Path& i_path, size_t i_address, size_t i_size);
+            ArchiveEntry(const Path& i_path, size_t i_address, size_t i_size, size_t i_uncompressedSize, bool i_compressed);
+        };
+
+        bool operator==(const ArchiveEntry& lhs, const ArchiveEntry& rhs);
+        bool operator!=(const ArchiveEntry& lhs, const ArchiveEntry& rhs);
+
+        /**
+         * Stores the directories of mounted archives so that they don't have to be read and decoded again the next time
+         * the archives are mounted.
+         *
+         * An archive's entries are only returned if the archive's size and modification time still match the values
+         * that were recorded when the entries were stored.
+         */
+        class MountCache {
+        private:
+            struct FileStamp {
+                uint64_t size;
+                int64_t modificationTime;
+            };
+
+            struct Archive {
+                FileStamp stamp;
+                std::vector<ArchiveEntry> entries;
+                // whether the archive was mounted since the cache was read; archives that weren't are not written back
+                mutable bool used = true;
+            };
+
+            std::map<Path, Archive> m_archives;
+            bool m_modified;
+        public:
+            MountCache();
+
+            /**
+             * Reads the cache from the given file. Returns an empty cache if the file does not exist or cannot be read.
+             * Archives which no longer exist are omitted.
+             */
+            static MountCache read(const Path& path);
+
+            /**
+             * Writes the cache to the given file, replacing the file if it exists. Archives that were read from a file
+             * but were not found or put since are omitted. The file is replaced atomically.
+             *
+             * @throws FileSystemException if the file cannot be written
+             */
+            void write(const Path& path) const;
+
+            /**
+             * Indicates whether entries were added or removed since the cache was created or read, or whether the cache
+             * contains archives that would be omitted when writing it.
+             */
+            bool modified() const;
+
+            size_t archiveCount() const;
+
+            /**
+             * Returns the entries stored for the archive at the given path, or nullptr if there are none or if the archive
+             * has changed since they were stored.
+             */
+            const std::vector<ArchiveEntry>* find(const Path& archivePath) const;
+
+            /**
+             * Stores the given entries for the archive at the given path.
+             */
+            void put(const Path& archivePath, std::vector<ArchiveEntry> entries);
+        private:
+            static FileStamp stamp(const Path& archivePath);
+        };
+    }
+}
+
+#endif //TRENCHBROOM_MOUNTCACHE_H
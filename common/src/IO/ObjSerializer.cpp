@@ -27,6 +27,7 @@
 #include "Model/Polyhedron.h"
 
 #include <set>
+#include <vector>
 
 namespace TrenchBroom {
     namespace IO {
@@ -148,15 +149,16 @@ namespace TrenchBroom {
             const vm::vec3& normal = face->boundary().normal;
             const size_t normalIndex = m_normals.index(normal);
 
-            IndexedVertexList indexedVertices;
-            indexedVertices.reserve(face->vertexCount());
+            const std::vector<vm::vec3> positions = face->vertexPositions();
+            std::vector<vm::vec2f> texCoords(positions.size());
+            face->textureCoords(positions.data(), positions.size(), texCoords.data());
 
-            for (const Model::BrushVertex* vertex : face->vertices()) {
-                const vm::vec3& position = vertex->position();
-                const vm::vec2f texCoords = face->textureCoords(position);
+            IndexedVertexList indexedVertices;
+            indexedVertices.reserve(positions.size());
 
-                const size_t vertexIndex = m_vertices.index(position);
-                const size_t texCoordsIndex = m_texCoords.index(texCoords);
+            for (size_t i = 0; i < positions.size(); ++i) {
+                const size_t vertexIndex = m_vertices.index(positions[i]);
+                const size_t texCoordsIndex = m_texCoords.index(texCoords[i]);
 
                 indexedVertices.push_back(IndexedVertex(vertexIndex, texCoordsIndex, normalIndex));
             }
@@ -26,10 +26,13 @@
 #include "IO/Quake3ShaderParser.h"
 #include "IO/SimpleParserStatus.h"
 
+#include <kdl/parallel.h>
 #include <kdl/vector_utils.h>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace TrenchBroom {
@@ -42,6 +45,12 @@ namespace TrenchBroom {
             initialize();
         }
 
+        bool Quake3ShaderFileSystem::doCanIndex() const {
+            // the shaders are linked against the file system while reloading, so they must not be served from an index
+            // that was built before the reload
+            return false;
+        }
+
         void Quake3ShaderFileSystem::doReadDirectory() {
             if (hasNext()) {
                 auto shaders = loadShaders();
@@ -54,17 +63,29 @@ namespace TrenchBroom {
 
             if (next().directoryExists(m_shaderSearchPath)) {
                 const auto paths = next().findItems(m_shaderSearchPath, FileExtensionMatcher("shader"));
-                for (const auto& path : paths) {
-                    const auto file = next().openFile(path);
-                    auto bufferedReader = file->reader().buffer();
+                const auto files = kdl::vec_transform(paths, [&](const auto& path) { return next().openFile(path); });
+
+                // parse the shader files in parallel, each with its own logger since loggers are not thread safe
+                using ParseResult = std::pair<std::vector<Assets::Quake3Shader>, std::unique_ptr<BufferedLogger>>;
+                auto parseResults = kdl::parallel_transform(files, [](const auto& file) {
+                    auto logger = std::make_unique<BufferedLogger>();
+                    auto shaders = std::vector<Assets::Quake3Shader>();
 
+                    auto bufferedReader = file->reader().buffer();
                     try {
                         Quake3ShaderParser parser(std::begin(bufferedReader), std::end(bufferedReader));
-                        SimpleParserStatus status(m_logger, file->path().asString());
-                        kdl::vec_append(result, parser.parse(status));
+                        SimpleParserStatus status(*logger, file->path().asString());
+                        shaders = parser.parse(status);
                     } catch (const ParserException& e) {
-                        m_logger.warn() << "Skipping malformed shader file " << path << ": " << e.what();
+                        logger->warn() << "Skipping malformed shader file " << file->path() << ": " << e.what();
                     }
+                    return ParseResult(std::move(shaders), std::move(logger));
+                });
+
+                // collect the results in the order of the files so that the result does not depend on the scheduling
+                for (auto& [shaders, logger] : parseResults) {
+                    logger->forward(m_logger);
+                    kdl::vec_append(result, shaders);
                 }
             }
 
@@ -89,24 +110,30 @@ namespace TrenchBroom {
 
         void Quake3ShaderFileSystem::linkTextures(const std::vector<Path>& textures, std::vector<Assets::Quake3Shader>& shaders) {
             m_logger.debug() << "Linking textures...";
+
+            // Index the shaders by path. If there are several shaders with the same path, the first one is linked.
+            auto shadersByPath = std::map<Path, size_t>();
+            for (size_t i = 0; i < shaders.size(); ++i) {
+                shadersByPath.emplace(shaders[i].shaderPath, i);
+            }
+
+            auto linked = std::vector<bool>(shaders.size(), false);
             for (const auto& texture : textures) {
                 const auto shaderPath = texture.deleteExtension();
 
                 // Only link a shader if it has not been linked yet.
                 if (!fileExists(shaderPath)) {
-                    const auto shaderIt = std::find_if(std::begin(shaders), std::end(shaders), [&shaderPath](const auto& shader){
-                        return shaderPath == shader.shaderPath;
-                    });
-
-                    if (shaderIt != std::end(shaders)) {
+                    const auto shaderIt = shadersByPath.find(shaderPath);
+                    if (shaderIt != std::end(shadersByPath)) {
                         // Found a matching shader.
-                        auto& shader = *shaderIt;
+                        const auto index = shaderIt->second;
+                        auto& shader = shaders[index];
 
                         auto shaderFile = std::make_shared<ObjectFile<Assets::Quake3Shader>>(shaderPath, shader);
                         m_root.addFile(shaderPath, shaderFile);
 
-                        // Remove the shader so that we don't revisit it when linking standalone shaders.
-                        shaders.erase(shaderIt);
+                        // Mark the shader so that we don't revisit it when linking standalone shaders.
+                        linked[index] = true;
                     } else {
                         // No matching shader found, generate one.
                         auto shader = Assets::Quake3Shader();
@@ -118,6 +145,16 @@ namespace TrenchBroom {
                     }
                 }
             }
+
+            // Remove the linked shaders in one pass instead of erasing each of them from the middle of the vector.
+            auto unlinked = std::vector<Assets::Quake3Shader>();
+            unlinked.reserve(shaders.size());
+            for (size_t i = 0; i < shaders.size(); ++i) {
+                if (!linked[i]) {
+                    unlinked.push_back(std::move(shaders[i]));
+                }
+            }
+            shaders = std::move(unlinked);
         }
 
         void Quake3ShaderFileSystem::linkStandaloneShaders(std::vector<Assets::Quake3Shader>& shaders) {
@@ -58,6 +58,7 @@ namespace TrenchBroom {
              */
             Quake3ShaderFileSystem(std::shared_ptr<FileSystem> fs, Path shaderSearchPath, std::vector<Path> textureSearchPaths, Logger& logger);
         private:
+            bool doCanIndex() const override;
             void doReadDirectory() override;
 
             std::vector<Assets::Quake3Shader> loadShaders() const;
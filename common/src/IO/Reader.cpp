@@ -26,6 +26,7 @@
 #include <cerrno>
 #include <cstring>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -70,12 +71,14 @@ namespace TrenchBroom {
             return doBuffer();
         }
 
-        Reader::FileSource::FileSource(std::FILE* file, const size_t offset, const size_t length) :
+        Reader::FileSource::FileSource(std::FILE* file, std::mutex& mutex, const size_t offset, const size_t length) :
         m_file(file),
+        m_mutex(mutex),
         m_offset(offset),
         m_length(length),
         m_position(0) {
             assert(m_file != nullptr);
+            const std::lock_guard<std::mutex> lock(m_mutex);
             std::rewind(m_file);
         }
 
@@ -93,6 +96,7 @@ namespace TrenchBroom {
             // of this reader and that no other reader will access the file while this reader is in use. This may be a
             // reasonable assumption, since we usually read files one by one.
 
+            const std::lock_guard<std::mutex> lock(m_mutex);
             const auto pos = std::ftell(m_file);
             if (pos < 0) {
                 throwError("ftell failed");
@@ -113,10 +117,11 @@ namespace TrenchBroom {
         }
 
         std::unique_ptr<Reader::Source> Reader::FileSource::doGetSubSource(const size_t position, const size_t length) const {
-            return std::make_unique<FileSource>(m_file, m_offset + position, length);
+            return std::make_unique<FileSource>(m_file, m_mutex, m_offset + position, length);
         }
 
         std::tuple<const char*, const char*, std::unique_ptr<char[]>> Reader::FileSource::doBuffer() const {
+            const std::lock_guard<std::mutex> lock(m_mutex);
             std::fseek(m_file, static_cast<long>(m_offset), SEEK_SET);
 
             auto buffer = std::make_unique<char[]>(m_length);
@@ -189,8 +194,8 @@ namespace TrenchBroom {
 
         Reader::~Reader() = default;
 
-        Reader Reader::from(std::FILE* file) {
-            return Reader(std::make_unique<FileSource>(file, 0, fileSize(file)));
+        Reader Reader::from(std::FILE* file, std::mutex& mutex) {
+            return Reader(std::make_unique<FileSource>(file, mutex, 0, fileSize(file)));
         }
 
         Reader Reader::from(const char* begin, const char* end) {
@@ -24,6 +24,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace TrenchBroom {
@@ -124,10 +125,14 @@ namespace TrenchBroom {
              * A reader source that reads directly from a file. Note that the seek position of the underlying C file
              * is kept in sync with this file source's position automatically, that is, two readers can read from the
              * same underlying file without causing problems.
+             *
+             * Since all readers of a file share its position indicator, every seek and the subsequent read is guarded
+             * by a mutex that belongs to the file, so that a file can be read on multiple threads at once.
              */
             class FileSource : public Source {
             private:
                 std::FILE* m_file;
+                std::mutex& m_mutex;
                 size_t m_offset;
                 size_t m_length;
                 size_t m_position;
@@ -136,10 +141,11 @@ namespace TrenchBroom {
                  * Creates a new reader source for the given underlying file at the given offset and length.
                  *
                  * @param file the file
+                 * @param mutex the mutex guarding the position indicator of the file
                  * @param offset the offset into the file at which this reader source should begin
                  * @param length the length of this reader source
                  */
-                FileSource(std::FILE* file, size_t offset, size_t length);
+                FileSource(std::FILE* file, std::mutex& mutex, size_t offset, size_t length);
             private:
                 size_t doGetSize() const override;
                 size_t doGetPosition() const override;
@@ -206,11 +212,13 @@ namespace TrenchBroom {
              * Creates a new reader that reads from the given file.
              *
              * @param file the file to read from
+             * @param mutex the mutex guarding the position indicator of the file, must be the same for all readers of
+             * the file
              * @return the reader
              *
              * @throw ReaderException if the reader cannot be created
              */
-            static Reader from(std::FILE* file);
+            static Reader from(std::FILE* file, std::mutex& mutex);
             /**
              * Creates a new reader that reads from the given memory region.
              *
@@ -21,6 +21,7 @@
 
 #include "Logger.h"
 #include "IO/File.h"
+#include "IO/MountCache.h"
 #include "IO/Reader.h"
 
 #include <kdl/string_format.h>
@@ -54,13 +55,13 @@ namespace TrenchBroom {
         WadFileSystem::WadFileSystem(const Path& path, Logger& logger) :
         WadFileSystem(nullptr, path, logger) {}
 
-        WadFileSystem::WadFileSystem(std::shared_ptr<FileSystem> next, const Path& path, Logger& logger) :
+        WadFileSystem::WadFileSystem(std::shared_ptr<FileSystem> next, const Path& path, Logger& logger, MountCache* mountCache) :
         ImageFileSystem(std::move(next), path),
         m_logger(logger) {
-            initialize();
+            initialize(mountCache);
         }
 
-        void WadFileSystem::doReadDirectory() {
+        std::vector<ArchiveEntry> WadFileSystem::doReadEntries() {
             auto reader = m_file->reader();
             if (reader.size() < WadLayout::MinFileSize) {
                 throw FileSystemException("File does not contain a directory.");
@@ -86,6 +87,9 @@ namespace TrenchBroom {
                 throw FileSystemException("File directory is out of bounds.");
             }
 
+            std::vector<ArchiveEntry> result;
+            result.reserve(entryCount);
+
             reader.seekFromBegin(directoryOffset);
             for (size_t i = 0; i < entryCount; ++i) {
                 const auto entryAddress = reader.readSize<int32_t>();
@@ -104,10 +108,15 @@ namespace TrenchBroom {
                     continue;
                 }
 
-                const auto path = IO::Path(entryName).addExtension(entryType);
-                auto file = std::make_shared<FileView>(path, m_file, entryAddress, entrySize);
-                m_root.addFile(path, file);
+                result.emplace_back(IO::Path(entryName).addExtension(entryType), entryAddress, entrySize);
             }
+
+            return result;
+        }
+
+        void WadFileSystem::doMountEntry(const ArchiveEntry& entry) {
+            auto file = std::make_shared<FileView>(entry.path, m_file, entry.address, entry.size);
+            m_root.addFile(entry.path, file);
         }
     }
 }
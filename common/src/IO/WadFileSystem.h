@@ -23,12 +23,14 @@
 #include "IO/ImageFileSystem.h"
 
 #include <memory>
+#include <vector>
 
 namespace TrenchBroom {
     class Logger;
 
     namespace IO {
         class FileSystem;
+        class MountCache;
         class Path;
 
         class WadFileSystem : public ImageFileSystem {
@@ -36,9 +38,10 @@ namespace TrenchBroom {
             Logger& m_logger;
         public:
             WadFileSystem(const Path& path, Logger& logger);
-            WadFileSystem(std::shared_ptr<FileSystem> next, const Path& path, Logger& logger);
+            WadFileSystem(std::shared_ptr<FileSystem> next, const Path& path, Logger& logger, MountCache* mountCache = nullptr);
         private:
-            void doReadDirectory() override;
+            std::vector<ArchiveEntry> doReadEntries() override;
+            void doMountEntry(const ArchiveEntry& entry) override;
         };
     }
 }
@@ -21,23 +21,42 @@
 
 #include "IO/File.h"
 #include "IO/DiskFileSystem.h"
+#include "IO/MountCache.h"
 
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
 
 namespace TrenchBroom {
     namespace IO {
-        // ZipFileSystem::ZipCompressedFile
+        const size_t ZipFileSystem::MaxCachedBytes = 32u * 1024u * 1024u;
+        const size_t ZipFileSystem::MaxIdleReaders = 2u;
 
-        ZipFileSystem::ZipCompressedFile::ZipCompressedFile(ZipFileSystem* owner, const mz_uint fileIndex) :
-        m_owner(owner),
-        m_fileIndex(fileIndex) {}
+        /**
+         * Helper to get the filename of a file in the zip archive
+         */
+        static std::string filename(mz_zip_archive& archive, const mz_uint fileIndex) {
+            // nameLen includes space for the null-terminator byte
+            const mz_uint nameLen = mz_zip_reader_get_filename(&archive, fileIndex, nullptr, 0);
+            if (nameLen == 0) {
+                return "";
+            }
 
-        std::shared_ptr<File> ZipFileSystem::ZipCompressedFile::doOpen() const {
-            const auto path = Path(m_owner->filename(m_fileIndex));
+            std::string result;
+            result.resize(static_cast<size_t>(nameLen - 1));
+
+            // NOTE: this will overwrite the std::string's null terminator, which is permitted in C++17 and later
+            mz_zip_reader_get_filename(&archive, fileIndex, result.data(), nameLen);
+
+            return result;
+        }
+
+        static std::shared_ptr<File> extract(mz_zip_archive& archive, const mz_uint fileIndex) {
+            const auto path = Path(filename(archive, fileIndex));
 
             mz_zip_archive_file_stat stat;
-            if (!mz_zip_reader_file_stat(&m_owner->m_archive, m_fileIndex, &stat)) {
+            if (!mz_zip_reader_file_stat(&archive, fileIndex, &stat)) {
                 throw FileSystemException("mz_zip_reader_file_stat failed for " + path.asString());
             }
 
@@ -45,65 +64,198 @@ namespace TrenchBroom {
             auto data = std::make_unique<char[]>(uncompressedSize);
             auto* begin = data.get();
 
-            if (!mz_zip_reader_extract_to_mem(&m_owner->m_archive, m_fileIndex, begin, uncompressedSize, 0)) {
+            if (!mz_zip_reader_extract_to_mem(&archive, fileIndex, begin, uncompressedSize, 0)) {
                 throw FileSystemException("mz_zip_reader_extract_to_mem failed for " + path.asString());
             }
 
             return std::make_shared<OwningBufferFile>(path, std::move(data), uncompressedSize);
         }
 
+        // ZipFileSystem::ArchiveReader
+
+        ZipFileSystem::ArchiveReader::ArchiveReader(const Path& path) :
+        m_file(std::make_unique<CFile>(path)) {
+            mz_zip_zero_struct(&m_archive);
+            if (mz_zip_reader_init_cfile(&m_archive, m_file->file(), m_file->size(), 0) != MZ_TRUE) {
+                throw FileSystemException("Error calling mz_zip_reader_init_cfile");
+            }
+        }
+
+        ZipFileSystem::ArchiveReader::~ArchiveReader() {
+            mz_zip_reader_end(&m_archive);
+        }
+
+        mz_zip_archive& ZipFileSystem::ArchiveReader::archive() {
+            return m_archive;
+        }
+
+        // ZipFileSystem::EntryCache
+
+        size_t ZipFileSystem::EntryCache::KeyHash::operator()(const Key& key) const {
+            return std::hash<const ZipFileSystem*>()(key.first) ^ (std::hash<mz_uint>()(key.second) << 1u);
+        }
+
+        ZipFileSystem::EntryCache& ZipFileSystem::EntryCache::instance() {
+            static EntryCache cache(MaxCachedBytes);
+            return cache;
+        }
+
+        ZipFileSystem::EntryCache::EntryCache(const size_t maxBytes) :
+        m_maxBytes(maxBytes),
+        m_bytes(0u) {}
+
+        std::shared_ptr<File> ZipFileSystem::EntryCache::get(const ZipFileSystem* owner, const mz_uint fileIndex) {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_index.find(Key(owner, fileIndex));
+            if (it == std::end(m_index)) {
+                return nullptr;
+            }
+
+            // move the entry to the front
+            m_entries.splice(std::begin(m_entries), m_entries, it->second);
+            return it->second->second;
+        }
+
+        void ZipFileSystem::EntryCache::put(const ZipFileSystem* owner, const mz_uint fileIndex, std::shared_ptr<File> file) {
+            const auto size = file->size();
+            const auto key = Key(owner, fileIndex);
+
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            if (size > m_maxBytes || m_index.count(key) > 0u) {
+                return;
+            }
+
+            while (m_bytes + size > m_maxBytes) {
+                evict(std::prev(std::end(m_entries)));
+            }
+
+            m_entries.emplace_front(key, std::move(file));
+            m_index.emplace(key, std::begin(m_entries));
+            m_bytes += size;
+        }
+
+        void ZipFileSystem::EntryCache::evict(const ZipFileSystem* owner) {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = std::begin(m_entries);
+            while (it != std::end(m_entries)) {
+                auto next = std::next(it);
+                if (it->first.first == owner) {
+                    evict(it);
+                }
+                it = next;
+            }
+        }
+
+        void ZipFileSystem::EntryCache::evict(const std::list<Entry>::iterator it) {
+            m_bytes -= it->second->size();
+            m_index.erase(it->first);
+            m_entries.erase(it);
+        }
+
+        // ZipFileSystem::ZipCompressedFile
+
+        ZipFileSystem::ZipCompressedFile::ZipCompressedFile(ZipFileSystem* owner, const mz_uint fileIndex) :
+        m_owner(owner),
+        m_fileIndex(fileIndex) {}
+
+        std::shared_ptr<File> ZipFileSystem::ZipCompressedFile::doOpen() const {
+            return m_owner->openEntry(m_fileIndex);
+        }
+
         // ZipFileSystem
 
         ZipFileSystem::ZipFileSystem(const Path& path) :
         ZipFileSystem(nullptr, path) {}
 
-        ZipFileSystem::ZipFileSystem(std::shared_ptr<FileSystem> next, const Path& path) :
-        ImageFileSystem(std::move(next), path) {
-            initialize();
+        // the archive readers open the archive file themselves
+        ZipFileSystem::ZipFileSystem(std::shared_ptr<FileSystem> next, const Path& path, MountCache* mountCache) :
+        ImageFileSystem(std::move(next), path, nullptr) {
+            // make sure that the cache outlives this file system
+            EntryCache::instance();
+            initialize(mountCache);
         }
 
         ZipFileSystem::~ZipFileSystem() {
-            mz_zip_reader_end(&m_archive);
+            EntryCache::instance().evict(this);
         }
 
-        void ZipFileSystem::doReadDirectory() {
-            mz_zip_zero_struct(&m_archive);
-
-            if (mz_zip_reader_init_cfile(&m_archive, m_file->file(), m_file->size(), 0) != MZ_TRUE) {
-                throw FileSystemException("Error calling mz_zip_reader_init_cfile");
+        std::vector<ArchiveEntry> ZipFileSystem::doReadEntries() {
+            {
+                // the archive may have changed since the readers were opened
+                const std::lock_guard<std::mutex> lock(m_archiveMutex);
+                m_idleReaders.clear();
             }
+            EntryCache::instance().evict(this);
 
-            const mz_uint numFiles = mz_zip_reader_get_num_files(&m_archive);
+            auto reader = acquireReader();
+            auto& archive = reader->archive();
+
+            std::vector<ArchiveEntry> result;
+
+            const mz_uint numFiles = mz_zip_reader_get_num_files(&archive);
             for (mz_uint i = 0; i < numFiles; ++i) {
-                if (!mz_zip_reader_is_file_a_directory(&m_archive, i)) {
-                    const auto path = Path(filename(i));
-                    m_root.addFile(path, std::make_unique<ZipCompressedFile>(this, i));
+                if (!mz_zip_reader_is_file_a_directory(&archive, i)) {
+                    // the address of an entry is its file index, its size is determined when it is opened
+                    result.emplace_back(Path(filename(archive, i)), static_cast<size_t>(i), 0u);
                 }
             }
 
-            const auto err = mz_zip_get_last_error(&m_archive);
+            const auto err = mz_zip_get_last_error(&archive);
             if (err != MZ_ZIP_NO_ERROR) {
                 throw FileSystemException(std::string("Error while reading compressed file: ") + mz_zip_get_error_string(err));
             }
+
+            releaseReader(std::move(reader));
+            return result;
+        }
+
+        void ZipFileSystem::doMountEntry(const ArchiveEntry& entry) {
+            m_root.addFile(entry.path, std::make_unique<ZipCompressedFile>(this, static_cast<mz_uint>(entry.address)));
+        }
+
+        std::shared_ptr<File> ZipFileSystem::openEntry(const mz_uint fileIndex) {
+            auto& cache = EntryCache::instance();
+            if (auto file = cache.get(this, fileIndex)) {
+                return file;
+            }
+
+            auto reader = acquireReader();
+            auto file = extract(reader->archive(), fileIndex);
+            releaseReader(std::move(reader));
+
+            cache.put(this, fileIndex, file);
+            return file;
         }
 
         /**
-         * Helper to get the filename of a file in the zip archive
+         * Returns an idle reader, or opens a new reader if all readers are in use. The archive is not opened until an
+         * entry is read, so mounting the archive from a mount cache does not read its central directory.
          */
-        std::string ZipFileSystem::filename(const mz_uint fileIndex) {
-            // nameLen includes space for the null-terminator byte
-            const mz_uint nameLen = mz_zip_reader_get_filename(&m_archive, fileIndex, nullptr, 0);
-            if (nameLen == 0) {
-                return "";
+        std::unique_ptr<ZipFileSystem::ArchiveReader> ZipFileSystem::acquireReader() {
+            {
+                const std::lock_guard<std::mutex> lock(m_archiveMutex);
+                if (!m_idleReaders.empty()) {
+                    auto reader = std::move(m_idleReaders.back());
+                    m_idleReaders.pop_back();
+                    return reader;
+                }
             }
 
-            std::string result;
-            result.resize(static_cast<size_t>(nameLen - 1));
-
-            // NOTE: this will overwrite the std::string's null terminator, which is permitted in C++17 and later
-            mz_zip_reader_get_filename(&m_archive, fileIndex, result.data(), nameLen);
+            return std::make_unique<ArchiveReader>(m_path);
+        }
 
-            return result;
+        /**
+         * Returns the given reader to the pool, or closes it if the pool already holds MaxIdleReaders readers.
+         */
+        void ZipFileSystem::releaseReader(std::unique_ptr<ArchiveReader> reader) {
+            {
+                const std::lock_guard<std::mutex> lock(m_archiveMutex);
+                if (m_idleReaders.size() < MaxIdleReaders) {
+                    m_idleReaders.push_back(std::move(reader));
+                    return;
+                }
+            }
+            // the surplus reader is closed here, outside of the lock
         }
     }
 }
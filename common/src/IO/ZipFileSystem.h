@@ -20,20 +20,79 @@
 #ifndef TRENCHBROOM_ZIPFILESYSTEM_H
 #define TRENCHBROOM_ZIPFILESYSTEM_H
 
+#include "Macros.h"
 #include "IO/ImageFileSystem.h"
 
+#include <list>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <miniz/miniz.h>
 
 namespace TrenchBroom {
     namespace IO {
+        class CFile;
+        class MountCache;
         class Path;
 
+        /**
+         * A file system backed by a ZIP archive.
+         *
+         * Entries are decompressed on demand by a pool of archive readers, each with its own file handle, so that
+         * several threads can open entries at the same time. At most MaxIdleReaders readers are kept open while they
+         * are not in use. The most recently decompressed entries of all ZIP archives are kept in memory up to a total of
+         * MaxCachedBytes, so that opening an entry again does not decompress it again.
+         */
         class ZipFileSystem : public ImageFileSystem {
+        public:
+            static const size_t MaxCachedBytes;
+            static const size_t MaxIdleReaders;
         private:
-            mz_zip_archive m_archive;
-        private:
+            class ArchiveReader {
+            private:
+                std::unique_ptr<CFile> m_file;
+                mz_zip_archive m_archive;
+            public:
+                explicit ArchiveReader(const Path& path);
+                ~ArchiveReader();
+
+                mz_zip_archive& archive();
+
+                deleteCopyAndMove(ArchiveReader)
+            };
+
+            /**
+             * The process wide cache of decompressed entries, shared by all ZIP archives.
+             */
+            class EntryCache {
+            private:
+                using Key = std::pair<const ZipFileSystem*, mz_uint>;
+                struct KeyHash {
+                    size_t operator()(const Key& key) const;
+                };
+                using Entry = std::pair<Key, std::shared_ptr<File>>;
+
+                std::mutex m_mutex;
+                size_t m_maxBytes;
+                size_t m_bytes;
+                // the most recently used entry is at the front
+                std::list<Entry> m_entries;
+                std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+            public:
+                static EntryCache& instance();
+
+                explicit EntryCache(size_t maxBytes);
+
+                std::shared_ptr<File> get(const ZipFileSystem* owner, mz_uint fileIndex);
+                void put(const ZipFileSystem* owner, mz_uint fileIndex, std::shared_ptr<File> file);
+                void evict(const ZipFileSystem* owner);
+            private:
+                void evict(std::list<Entry>::iterator it);
+            };
+
             class ZipCompressedFile : public FileEntry {
             private:
                 ZipFileSystem* m_owner;
@@ -44,14 +103,21 @@ namespace TrenchBroom {
                 std::shared_ptr<File> doOpen() const override;
             };
             friend class ZipCompressedFile;
+
+            // guards the idle readers, but is not held while an entry is decompressed
+            mutable std::mutex m_archiveMutex;
+            std::vector<std::unique_ptr<ArchiveReader>> m_idleReaders;
         public:
             explicit ZipFileSystem(const Path& path);
-            ZipFileSystem(std::shared_ptr<FileSystem> next, const Path& path);
+            ZipFileSystem(std::shared_ptr<FileSystem> next, const Path& path, MountCache* mountCache = nullptr);
             ~ZipFileSystem() override;
         private:
-            void doReadDirectory() override;
+            std::vector<ArchiveEntry> doReadEntries() override;
+            void doMountEntry(const ArchiveEntry& entry) override;
         private:
-            std::string filename(mz_uint fileIndex);
+            std::shared_ptr<File> openEntry(mz_uint fileIndex);
+            std::unique_ptr<ArchiveReader> acquireReader();
+            void releaseReader(std::unique_ptr<ArchiveReader> reader);
         };
     }
 }
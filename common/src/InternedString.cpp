@@ -0,0 +1,149 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InternedString.h"
+
+#include <kdl/string_format.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace TrenchBroom {
+    struct InternedString::Entry {
+        std::string str;
+        /** The lower case version of str, computed on demand. */
+        mutable std::atomic<const Entry*> lowerCase;
+
+        explicit Entry(const std::string_view i_str) :
+        str(i_str),
+        lowerCase(nullptr) {}
+    };
+
+    class InternedString::Table {
+    private:
+        mutable std::shared_mutex m_mutex;
+        // the entries are allocated individually so that the keys can refer to their strings
+        std::unordered_map<std::string_view, std::unique_ptr<Entry>> m_entries;
+        std::size_t m_storedBytes{0u};
+
+        std::atomic<std::size_t> m_internedStrings{0u};
+        std::atomic<std::size_t> m_internedBytes{0u};
+    public:
+        const Entry* intern(const std::string_view str) {
+            m_internedStrings += 1u;
+            m_internedBytes += str.size();
+
+            {
+                std::shared_lock<std::shared_mutex> lock(m_mutex);
+                const auto it = m_entries.find(str);
+                if (it != std::end(m_entries)) {
+                    return it->second.get();
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            const auto it = m_entries.find(str);
+            if (it != std::end(m_entries)) {
+                return it->second.get();
+            }
+
+            auto entry = std::make_unique<Entry>(str);
+            const auto* result = entry.get();
+            m_entries.emplace(result->str, std::move(entry));
+            m_storedBytes += str.size();
+            return result;
+        }
+
+        Statistics statistics() const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return { m_entries.size(), m_storedBytes, m_internedStrings, m_internedBytes };
+        }
+    };
+
+    InternedString::InternedString() {
+        static const auto* empty = table().intern(std::string_view());
+        m_entry = empty;
+    }
+
+    InternedString::InternedString(const std::string_view str) :
+    m_entry(table().intern(str)) {}
+
+    InternedString::InternedString(const Entry* entry) :
+    m_entry(entry) {}
+
+    const std::string& InternedString::str() const {
+        return m_entry->str;
+    }
+
+    bool InternedString::empty() const {
+        return m_entry->str.empty();
+    }
+
+    InternedString InternedString::lowerCase() const {
+        const auto* lowerCase = m_entry->lowerCase.load(std::memory_order_acquire);
+        if (lowerCase == nullptr) {
+            // if several threads get here at the same time, they all compute and store the same entry
+            lowerCase = table().intern(kdl::str_to_lower(m_entry->str));
+            m_entry->lowerCase.store(lowerCase, std::memory_order_release);
+        }
+        return InternedString(lowerCase);
+    }
+
+    bool InternedString::operator==(const InternedString& rhs) const {
+        return m_entry == rhs.m_entry;
+    }
+
+    bool InternedString::operator!=(const InternedString& rhs) const {
+        return m_entry != rhs.m_entry;
+    }
+
+    bool InternedString::operator==(const std::string_view rhs) const {
+        return m_entry->str == rhs;
+    }
+
+    bool InternedString::operator!=(const std::string_view rhs) const {
+        return m_entry->str != rhs;
+    }
+
+    bool InternedString::operator<(const InternedString& rhs) const {
+        return m_entry != rhs.m_entry && m_entry->str < rhs.m_entry->str;
+    }
+
+    std::size_t InternedString::hash() const {
+        return std::hash<const Entry*>()(m_entry);
+    }
+
+    InternedString::Statistics InternedString::statistics() {
+        return table().statistics();
+    }
+
+    InternedString::Table& InternedString::table() {
+        static Table table;
+        return table;
+    }
+
+    std::ostream& operator<<(std::ostream& stream, const InternedString& str) {
+        stream << str.str();
+        return stream;
+    }
+}
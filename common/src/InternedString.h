@@ -0,0 +1,102 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRENCHBROOM_INTERNEDSTRING_H
+#define TRENCHBROOM_INTERNEDSTRING_H
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace TrenchBroom {
+    /**
+     * A handle to a string that is stored in a global table. Every distinct string is stored only once, no matter how
+     * many handles refer to it, so copying a handle and comparing two handles for equality is as cheap as copying and
+     * comparing a pointer.
+     *
+     * Use this for strings that are repeated many times, such as texture names and entity attribute names, but not for
+     * strings that are mostly unique, such as attribute values, because the table never shrinks.
+     *
+     * The table is shared by all threads.
+     */
+    class InternedString {
+    public:
+        struct Statistics {
+            /** The number of distinct strings in the table. */
+            std::size_t distinctStrings;
+            /** The number of characters stored in the table. */
+            std::size_t storedBytes;
+            /** The number of strings that were interned. */
+            std::size_t internedStrings;
+            /** The number of characters of all strings that were interned. */
+            std::size_t internedBytes;
+        };
+    private:
+        struct Entry;
+        class Table;
+        const Entry* m_entry;
+    public:
+        /**
+         * Creates a handle to the empty string.
+         */
+        InternedString();
+        explicit InternedString(std::string_view str);
+
+        const std::string& str() const;
+        bool empty() const;
+
+        /**
+         * Returns a handle to the lower case version of this string. The result is computed only once per distinct
+         * string.
+         */
+        InternedString lowerCase() const;
+
+        bool operator==(const InternedString& rhs) const;
+        bool operator!=(const InternedString& rhs) const;
+        bool operator==(std::string_view rhs) const;
+        bool operator!=(std::string_view rhs) const;
+
+        /**
+         * Compares the referenced strings lexicographically.
+         */
+        bool operator<(const InternedString& rhs) const;
+
+        std::size_t hash() const;
+
+        static Statistics statistics();
+    private:
+        explicit InternedString(const Entry* entry);
+        static Table& table();
+    };
+
+    std::ostream& operator<<(std::ostream& stream, const InternedString& str);
+}
+
+namespace std {
+    template <>
+    struct hash<TrenchBroom::InternedString> {
+        std::size_t operator()(const TrenchBroom::InternedString& str) const {
+            return str.hash();
+        }
+    };
+}
+
+#endif //TRENCHBROOM_INTERNEDSTRING_H
@@ -120,4 +120,19 @@ namespace TrenchBroom {
 
     void NullLogger::doLog(const LogLevel /* level */, const std::string& /* message */) {}
     void NullLogger::doLog(const LogLevel /* level */, const QString& /* message */) {}
+
+    void BufferedLogger::forward(Logger& logger) {
+        for (const auto& [level, message] : m_messages) {
+            logger.log(level, message);
+        }
+        m_messages.clear();
+    }
+
+    void BufferedLogger::doLog(const LogLevel level, const std::string& message) {
+        m_messages.emplace_back(level, message);
+    }
+
+    void BufferedLogger::doLog(const LogLevel level, const QString& message) {
+        doLog(level, message.toStdString());
+    }
 }
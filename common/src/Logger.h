@@ -22,6 +22,8 @@
 
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 class QString;
 
@@ -87,6 +89,23 @@ namespace TrenchBroom {
         void doLog(LogLevel level, const std::string& message) override;
         void doLog(LogLevel level, const QString& message) override;
     };
+
+    /**
+     * Collects all logged messages so that they can be forwarded to another logger later, e.g. to pass messages logged
+     * on a worker thread to a logger that may only be used on the main thread.
+     */
+    class BufferedLogger : public Logger {
+    private:
+        std::vector<std::pair<LogLevel, std::string>> m_messages;
+    public:
+        /**
+         * Logs all collected messages to the given logger and clears them.
+         */
+        void forward(Logger& logger);
+    private:
+        void doLog(LogLevel level, const std::string& message) override;
+        void doLog(LogLevel level, const QString& message) override;
+    };
 }
 
 #endif /* defined(TrenchBroom_Logger) */
@@ -21,6 +21,7 @@
 
 #include "Assets/AttributeDefinition.h"
 #include "Assets/EntityDefinition.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/EntityAttributeSnapshot.h"
 
 #include <kdl/collection_utils.h>
@@ -112,6 +113,7 @@ namespace TrenchBroom {
             m_attributes.updateDefinitions(m_definition);
             if (m_definition != nullptr)
                 m_definition->incUsageCount();
+            EditorStateGeneration::increment();
         }
 
         const Assets::AttributeDefinition* AttributableNode::attributeDefinition(const std::string& name) const {
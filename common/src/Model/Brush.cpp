@@ -19,6 +19,7 @@
 
 #include "Brush.h"
 
+#include "Allocator.h"
 #include "Exceptions.h"
 #include "FloatType.h"
 #include "Polyhedron.h"
@@ -26,6 +27,7 @@
 #include "Model/BrushFace.h"
 #include "Model/BrushGeometry.h"
 #include "Model/BrushSnapshot.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/Entity.h"
 #include "Model/FindContainerVisitor.h"
 #include "Model/FindGroupVisitor.h"
@@ -39,6 +41,7 @@
 #include "Model/World.h"
 #include "Renderer/BrushRendererBrushCache.h"
 
+#include <kdl/parallel.h>
 #include <kdl/vector_utils.h>
 
 #include <vecmath/intersection.h>
@@ -446,6 +449,7 @@ namespace TrenchBroom {
             m_faces.push_back(face);
             face->setBrush(this);
             invalidateVertexCache();
+            EditorStateGeneration::increment();
             if (face->selected()) {
                 incChildSelectionCount(1);
             }
@@ -480,6 +484,7 @@ namespace TrenchBroom {
             face->setGeometry(nullptr);
             face->setBrush(nullptr);
             invalidateVertexCache();
+            EditorStateGeneration::increment();
         }
 
         void Brush::cloneFaceAttributesFrom(const std::vector<Brush*>& brushes) {
@@ -682,16 +687,7 @@ namespace TrenchBroom {
         }
 
         bool Brush::containsPoint(const vm::vec3& point) const {
-            if (!logicalBounds().contains(point)) {
-                return false;
-            } else {
-                for (const auto* face : m_faces) {
-                    if (face->boundary().point_status(point) == vm::plane_status::above) {
-                        return false;
-                    }
-                }
-                return true;
-            }
+            return logicalBounds().contains(point) && m_facePlanes.contains(point);
         }
 
         std::vector<BrushFace*> Brush::incidentFaces(const BrushVertex* vertex) const {
@@ -1164,38 +1160,31 @@ namespace TrenchBroom {
         }
 
         std::vector<Brush*> Brush::subtract(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const std::vector<Brush*>& subtrahends) const {
-            auto result = std::vector<BrushGeometry>{*m_geometry};
-
-            for (auto* subtrahend : subtrahends) {
-                auto nextResults = std::vector<BrushGeometry>();
-
-                for (const BrushGeometry& fragment : result) {
-                    auto subFragments = fragment.subtract(*subtrahend->m_geometry);
+            return createBrushes(factory, worldBounds, defaultTextureName, subtractGeometry(subtrahends), subtrahends);
+        }
 
-                    nextResults.reserve(nextResults.size() + subFragments.size());
-                    for (auto& subFragment : subFragments) {
-                        nextResults.push_back(std::move(subFragment));
-                    }
-                }
+        std::vector<Brush*> Brush::subtract(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, Brush* subtrahend) const {
+            return subtract(factory, worldBounds, defaultTextureName, std::vector<Brush*>{subtrahend});
+        }
 
-                result = std::move(nextResults);
-            }
+        std::vector<std::vector<Brush*>> Brush::subtractAll(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const std::vector<Brush*>& minuends, const std::vector<std::vector<Brush*>>& subtrahends) {
+            assert(minuends.size() == subtrahends.size());
 
-            std::vector<Brush*> brushes;
-            brushes.reserve(result.size());
+            auto geometries = std::vector<std::vector<BrushGeometry>>(minuends.size());
+            kdl::parallel_for(minuends.size(), [&](const size_t i) {
+                // the polyhedron allocator pools may only be used on the main thread
+                const AllocatorBypass bypass;
+                geometries[i] = minuends[i]->subtractGeometry(subtrahends[i]);
+            });
 
-            for (const auto& geometry : result) {
-                try {
-                    auto* brush = createBrush(factory, worldBounds, defaultTextureName, geometry, subtrahends);
-                    brushes.push_back(brush);
-                } catch (const GeometryException&) {}
+            // creating the brushes updates the texture usage counts, which is not thread safe
+            auto result = std::vector<std::vector<Brush*>>();
+            result.reserve(minuends.size());
+            for (size_t i = 0u; i < minuends.size(); ++i) {
+                result.push_back(minuends[i]->createBrushes(factory, worldBounds, defaultTextureName, geometries[i], subtrahends[i]));
             }
 
-            return brushes;
-        }
-
-        std::vector<Brush*> Brush::subtract(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, Brush* subtrahend) const {
-            return subtract(factory, worldBounds, defaultTextureName, std::vector<Brush*>{subtrahend});
+            return result;
         }
 
         void Brush::intersect(const vm::bbox3& worldBounds, const Brush* brush) {
@@ -1220,6 +1209,45 @@ namespace TrenchBroom {
             return result;
         }
 
+        std::vector<BrushGeometry> Brush::subtractGeometry(const std::vector<Brush*>& subtrahends) const {
+            auto result = std::vector<BrushGeometry>{*m_geometry};
+
+            for (auto* subtrahend : subtrahends) {
+                if (!logicalBounds().intersects(subtrahend->logicalBounds())) {
+                    continue;
+                }
+
+                auto nextResults = std::vector<BrushGeometry>();
+
+                for (const BrushGeometry& fragment : result) {
+                    auto subFragments = fragment.subtract(*subtrahend->m_geometry);
+
+                    nextResults.reserve(nextResults.size() + subFragments.size());
+                    for (auto& subFragment : subFragments) {
+                        nextResults.push_back(std::move(subFragment));
+                    }
+                }
+
+                result = std::move(nextResults);
+            }
+
+            return result;
+        }
+
+        std::vector<Brush*> Brush::createBrushes(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const std::vector<BrushGeometry>& geometries, const std::vector<Brush*>& subtrahends) const {
+            std::vector<Brush*> brushes;
+            brushes.reserve(geometries.size());
+
+            for (const auto& geometry : geometries) {
+                try {
+                    auto* brush = createBrush(factory, worldBounds, defaultTextureName, geometry, subtrahends);
+                    brushes.push_back(brush);
+                } catch (const GeometryException&) {}
+            }
+
+            return brushes;
+        }
+
         Brush* Brush::createBrush(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const BrushGeometry& geometry, const std::vector<Brush*>& subtrahends) const {
             std::vector<BrushFace*> faces(0);
             faces.reserve(geometry.faceCount());
@@ -1246,22 +1274,31 @@ namespace TrenchBroom {
         }
 
         void Brush::updateFacesFromGeometry(const vm::bbox3& /* worldBounds */, const BrushGeometry& brushGeometry) {
+            const auto oldFaceCount = m_faces.size();
             m_faces.clear();
 
+            size_t keptFaceCount = 0u;
             for (const auto* faceG : brushGeometry.faces()) {
                 auto* face = faceG->payload();
                 if (face != nullptr) { // could happen if the brush isn't fully specified
                     assert(face->geometry() == faceG);
                     if (face->brush() == nullptr) {
+                        // addFace increments the editor state generation
                         addFace(face);
                     } else {
                         m_faces.push_back(face);
+                        ++keptFaceCount;
                     }
                     face->resetTexCoordSystemCache();
                 }
             }
 
             invalidateVertexCache();
+
+            // only a change of the face set affects the editor state, moving the faces does not
+            if (keptFaceCount != oldFaceCount) {
+                EditorStateGeneration::increment();
+            }
         }
 
         void Brush::updatePointsFromVertices(const vm::bbox3& worldBounds) {
@@ -1287,6 +1324,7 @@ namespace TrenchBroom {
 
             AddFacesToGeometry addFacesToGeometry(*m_geometry, m_faces);
             updateFacesFromGeometry(worldBounds, *m_geometry);
+            m_facePlanes = PackedPlanes<FloatType>(kdl::vec_transform(m_faces, [](const auto* face) { return face->boundary(); }));
 
             if (addFacesToGeometry.brushEmpty()) {
                 throw GeometryException("Brush is empty");
@@ -1306,6 +1344,7 @@ namespace TrenchBroom {
             }
             delete m_geometry;
             m_geometry = nullptr;
+            m_facePlanes = PackedPlanes<FloatType>();
         }
 
         bool Brush::checkGeometry() const {
@@ -1422,13 +1461,12 @@ namespace TrenchBroom {
                 return BrushFaceHit();
             }
 
-            for (auto* face : m_faces) {
-                const auto distance = face->intersectWithRay(ray);
-                if (!vm::is_nan(distance)) {
-                    return BrushFaceHit(face, distance);
-                }
+            // the ray enters the brush through the face whose plane it enters last
+            const auto [distance, faceIndex] = m_facePlanes.intersectWithRay(ray);
+            if (vm::is_nan(distance)) {
+                return BrushFaceHit();
             }
-            return BrushFaceHit();
+            return BrushFaceHit(m_faces[faceIndex], distance);
         }
 
         Node* Brush::doGetContainer() const {
@@ -1531,6 +1569,10 @@ namespace TrenchBroom {
             m_brushRendererBrushCache->invalidateVertexCache();
         }
 
+        void Brush::invalidateTextureCache() {
+            m_brushRendererBrushCache->invalidateTextureCache();
+        }
+
         Renderer::BrushRendererBrushCache& Brush::brushRendererBrushCache() const {
             return *m_brushRendererBrushCache;
         }
@@ -26,6 +26,7 @@
 #include "Model/HitType.h"
 #include "Model/Node.h"
 #include "Model/Object.h"
+#include "Model/PackedPlanes.h"
 #include "Model/TagType.h"
 
 #include <vecmath/forward.h>
@@ -63,6 +64,10 @@ namespace TrenchBroom {
         private:
             std::vector<BrushFace*> m_faces;
             BrushGeometry* m_geometry;
+            /**
+             * The boundaries of the faces in the order of m_faces, updated whenever the geometry is built.
+             */
+            PackedPlanes<FloatType> m_facePlanes;
 
             mutable bool m_transparent;
             mutable std::unique_ptr<Renderer::BrushRendererBrushCache> m_brushRendererBrushCache; // unique_ptr for breaking header dependencies
@@ -231,11 +236,31 @@ namespace TrenchBroom {
              */
             std::vector<Brush*> subtract(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const std::vector<Brush*>& subtrahends) const;
             std::vector<Brush*> subtract(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, Brush* subtrahend) const;
+
+            /**
+             * Subtracts the subtrahends at index i of `subtrahends` from the minuend at index i of `minuends` for
+             * every i. The minuends are not modified.
+             *
+             * The geometric subtractions are independent of each other and are computed in parallel, while the
+             * resulting brushes are created on the calling thread.
+             *
+             * @param minuends the brushes to subtract from
+             * @param subtrahends for each minuend, the brushes to subtract from it
+             * @return for each minuend, the subtraction result
+             */
+            static std::vector<std::vector<Brush*>> subtractAll(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const std::vector<Brush*>& minuends, const std::vector<std::vector<Brush*>>& subtrahends);
             void intersect(const vm::bbox3& worldBounds, const Brush* brush);
 
             // transformation
             bool canTransform(const vm::mat4x4& transformation, const vm::bbox3& worldBounds) const;
         private:
+            /**
+             * Computes the geometry of the subtraction result. Subtrahends whose bounds do not intersect the bounds of
+             * `this` are skipped. Does not modify any brush, so this can be called for several brushes concurrently.
+             */
+            std::vector<BrushGeometry> subtractGeometry(const std::vector<Brush*>& subtrahends) const;
+            std::vector<Brush*> createBrushes(const ModelFactory& factory, const vm::bbox3& worldBounds, const std::string& defaultTextureName, const std::vector<BrushGeometry>& geometries, const std::vector<Brush*>& subtrahends) const;
+
             /**
              * Final step of CSG subtraction; takes the geometry that is the result of the subtraction, and turns it
              * into a Brush by copying texturing from `this` (for un-clipped faces) or the brushes in `subtrahends`
@@ -308,6 +333,10 @@ namespace TrenchBroom {
              * Only exposed to be called by BrushFace
              */
             void invalidateVertexCache();
+            /**
+             * Only exposed to be called by BrushFace
+             */
+            void invalidateTextureCache();
             Renderer::BrushRendererBrushCache& brushRendererBrushCache() const;
         private: // implement Taggable interface
         public:
@@ -46,6 +46,7 @@
 
 #include <sstream>
 #include <string>
+#include <variant>
 
 namespace TrenchBroom {
     namespace Model {
@@ -57,7 +58,7 @@ namespace TrenchBroom {
             return halfEdge->edge();
         }
 
-        BrushFace::BrushFace(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const BrushFaceAttributes& attribs, std::unique_ptr<TexCoordSystem> texCoordSystem) :
+        BrushFace::BrushFace(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const BrushFaceAttributes& attribs, TexCoordSystemStorage texCoordSystem) :
         m_brush(nullptr),
         m_lineNumber(0),
         m_lineCount(0),
@@ -66,18 +67,17 @@ namespace TrenchBroom {
         m_geometry(nullptr),
         m_markedToRenderFace(false),
         m_attribs(attribs) {
-            ensure(m_texCoordSystem != nullptr, "texCoordSystem is null");
             setPoints(point0, point1, point2);
         }
 
         BrushFace* BrushFace::createParaxial(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const std::string& textureName) {
             const BrushFaceAttributes attribs(textureName);
-            return new BrushFace(point0, point1, point2, attribs, std::make_unique<ParaxialTexCoordSystem>(point0, point1, point2, attribs));
+            return new BrushFace(point0, point1, point2, attribs, ParaxialTexCoordSystem(point0, point1, point2, attribs));
         }
 
         BrushFace* BrushFace::createParallel(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const std::string& textureName) {
             const BrushFaceAttributes attribs(textureName);
-            return new BrushFace(point0, point1, point2, attribs, std::make_unique<ParallelTexCoordSystem>(point0, point1, point2, attribs));
+            return new BrushFace(point0, point1, point2, attribs, ParallelTexCoordSystem(point0, point1, point2, attribs));
         }
 
         void BrushFace::sortFaces(std::vector<BrushFace*>& faces) {
@@ -109,12 +109,11 @@ namespace TrenchBroom {
             m_lineNumber = 0;
             m_lineCount = 0;
             m_selected = false;
-            m_texCoordSystem = nullptr;
             m_geometry = nullptr;
         }
 
         BrushFace* BrushFace::clone() const {
-            BrushFace* result = new BrushFace(points()[0], points()[1], points()[2], textureName(), m_texCoordSystem->clone());
+            BrushFace* result = new BrushFace(points()[0], points()[1], points()[2], textureName(), m_texCoordSystem);
             result->m_attribs = m_attribs;
             result->setFilePosition(m_lineNumber, m_lineCount);
             if (m_selected)
@@ -123,15 +122,15 @@ namespace TrenchBroom {
         }
 
         BrushFaceSnapshot* BrushFace::takeSnapshot() {
-            return new BrushFaceSnapshot(this, *m_texCoordSystem);
+            return new BrushFaceSnapshot(this, texCoordSystem());
         }
 
         std::unique_ptr<TexCoordSystemSnapshot> BrushFace::takeTexCoordSystemSnapshot() const {
-            return m_texCoordSystem->takeSnapshot();
+            return texCoordSystem().takeSnapshot();
         }
 
         void BrushFace::restoreTexCoordSystemSnapshot(const TexCoordSystemSnapshot& coordSystemSnapshot) {
-            coordSystemSnapshot.restore(*m_texCoordSystem);
+            coordSystemSnapshot.restore(texCoordSystem());
             invalidateVertexCache();
         }
 
@@ -140,16 +139,16 @@ namespace TrenchBroom {
             const auto seam = vm::intersect_plane_plane(sourceFacePlane, m_boundary);
             const auto refPoint = vm::project_point(seam, center());
 
-            coordSystemSnapshot.restore(*m_texCoordSystem);
+            coordSystemSnapshot.restore(texCoordSystem());
 
             // Get the texcoords at the refPoint using the source face's attribs and tex coord system
-            const auto desriedCoords = m_texCoordSystem->getTexCoords(refPoint, attribs) * attribs.textureSize();
+            const auto desriedCoords = texCoordSystem().getTexCoords(refPoint, attribs) * attribs.textureSize();
 
-            m_texCoordSystem->updateNormal(sourceFacePlane.normal, m_boundary.normal, m_attribs, wrapStyle);
+            texCoordSystem().updateNormal(sourceFacePlane.normal, m_boundary.normal, m_attribs, wrapStyle);
 
             // Adjust the offset on this face so that the texture coordinates at the refPoint stay the same
             if (!vm::is_zero(seam.direction, vm::C::almost_zero())) {
-                const auto currentCoords = m_texCoordSystem->getTexCoords(refPoint, m_attribs) * m_attribs.textureSize();
+                const auto currentCoords = texCoordSystem().getTexCoords(refPoint, m_attribs) * m_attribs.textureSize();
                 const auto offsetChange = desriedCoords - currentCoords;
                 m_attribs.setOffset(correct(m_attribs.modOffset(m_attribs.offset() + offsetChange), 4));
             }
@@ -245,14 +244,12 @@ namespace TrenchBroom {
         void BrushFace::setAttribs(const BrushFaceAttributes& attribs) {
             const float oldRotation = m_attribs.rotation();
             m_attribs = attribs;
-            m_texCoordSystem->setRotation(m_boundary.normal, oldRotation, m_attribs.rotation());
+            texCoordSystem().setRotation(m_boundary.normal, oldRotation, m_attribs.rotation());
             updateBrush();
         }
 
         void BrushFace::resetTexCoordSystemCache() {
-            if (m_texCoordSystem != nullptr) {
-                m_texCoordSystem->resetCache(m_points[0], m_points[1], m_points[2], m_attribs);
-            }
+            texCoordSystem().resetCache(m_points[0], m_points[1], m_points[2], m_attribs);
         }
 
         const std::string& BrushFace::textureName() const {
@@ -333,7 +330,7 @@ namespace TrenchBroom {
         }
 
         void BrushFace::updateTexture(Assets::TextureManager& textureManager) {
-            Assets::Texture* texture = textureManager.texture(textureName());
+            Assets::Texture* texture = textureManager.texture(m_attribs.internedTextureName());
             setTexture(texture);
         }
 
@@ -342,8 +339,18 @@ namespace TrenchBroom {
                 return false;
             }
 
+            const auto oldTextureSize = m_attribs.textureSize();
             m_attribs.setTexture(texture);
-            updateBrush();
+
+            if (m_brush != nullptr) {
+                m_brush->faceDidChange();
+                if (m_attribs.textureSize() == oldTextureSize) {
+                    // the texture coordinates only depend on the texture size, so the cached vertices remain valid
+                    m_brush->invalidateTextureCache();
+                } else {
+                    m_brush->invalidateVertexCache();
+                }
+            }
             return true;
         }
 
@@ -404,7 +411,7 @@ namespace TrenchBroom {
 
             const auto oldRotation = m_attribs.rotation();
             m_attribs.setRotation(rotation);
-            m_texCoordSystem->setRotation(m_boundary.normal, oldRotation, rotation);
+            texCoordSystem().setRotation(m_boundary.normal, oldRotation, rotation);
             updateBrush();
             return true;
         }
@@ -454,32 +461,32 @@ namespace TrenchBroom {
         }
 
         vm::vec3 BrushFace::textureXAxis() const {
-            return m_texCoordSystem->xAxis();
+            return texCoordSystem().xAxis();
         }
 
         vm::vec3 BrushFace::textureYAxis() const {
-            return m_texCoordSystem->yAxis();
+            return texCoordSystem().yAxis();
         }
 
         void BrushFace::resetTextureAxes() {
-            m_texCoordSystem->resetTextureAxes(m_boundary.normal);
+            texCoordSystem().resetTextureAxes(m_boundary.normal);
             invalidateVertexCache();
         }
 
         void BrushFace::moveTexture(const vm::vec3& up, const vm::vec3& right, const vm::vec2f& offset) {
-            m_texCoordSystem->moveTexture(m_boundary.normal, up, right, offset, m_attribs);
+            texCoordSystem().moveTexture(m_boundary.normal, up, right, offset, m_attribs);
             invalidateVertexCache();
         }
 
         void BrushFace::rotateTexture(const float angle) {
             const float oldRotation = m_attribs.rotation();
-            m_texCoordSystem->rotateTexture(m_boundary.normal, angle, m_attribs);
-            m_texCoordSystem->setRotation(m_boundary.normal, oldRotation, m_attribs.rotation());
+            texCoordSystem().rotateTexture(m_boundary.normal, angle, m_attribs);
+            texCoordSystem().setRotation(m_boundary.normal, oldRotation, m_attribs.rotation());
             invalidateVertexCache();
         }
 
         void BrushFace::shearTexture(const vm::vec2f& factors) {
-            m_texCoordSystem->shearTexture(m_boundary.normal, factors);
+            texCoordSystem().shearTexture(m_boundary.normal, factors);
             invalidateVertexCache();
         }
 
@@ -500,7 +507,7 @@ namespace TrenchBroom {
 
             setPoints(m_points[0], m_points[1], m_points[2]);
 
-            m_texCoordSystem->transform(oldBoundary, m_boundary, transform, m_attribs, lockTexture, invariant);
+            texCoordSystem().transform(oldBoundary, m_boundary, transform, m_attribs, lockTexture, invariant);
         }
 
         void BrushFace::invert() {
@@ -527,12 +534,12 @@ namespace TrenchBroom {
                 const auto refPoint = project_point(seam, center());
 
                 // Get the texcoords at the refPoint using the old face's attribs and tex coord system
-                const auto desriedCoords = m_texCoordSystem->getTexCoords(refPoint, m_attribs) * m_attribs.textureSize();
+                const auto desriedCoords = texCoordSystem().getTexCoords(refPoint, m_attribs) * m_attribs.textureSize();
 
-                m_texCoordSystem->updateNormal(oldPlane.normal, m_boundary.normal, m_attribs, WrapStyle::Projection);
+                texCoordSystem().updateNormal(oldPlane.normal, m_boundary.normal, m_attribs, WrapStyle::Projection);
 
                 // Adjust the offset on this face so that the texture coordinates at the refPoint stay the same
-                const auto currentCoords = m_texCoordSystem->getTexCoords(refPoint, m_attribs) * m_attribs.textureSize();
+                const auto currentCoords = texCoordSystem().getTexCoords(refPoint, m_attribs) * m_attribs.textureSize();
                 const auto offsetChange = desriedCoords - currentCoords;
                 m_attribs.setOffset(correct(m_attribs.modOffset(m_attribs.offset() + offsetChange), 4));
             }
@@ -551,7 +558,7 @@ namespace TrenchBroom {
         }
 
         vm::mat4x4 BrushFace::projectToBoundaryMatrix() const {
-            const auto texZAxis = m_texCoordSystem->fromMatrix(vm::vec2f::zero(), vm::vec2f::one()) * vm::vec3::pos_z();
+            const auto texZAxis = texCoordSystem().fromMatrix(vm::vec2f::zero(), vm::vec2f::one()) * vm::vec3::pos_z();
             const auto worldToPlaneMatrix = vm::plane_projection_matrix(m_boundary.distance, m_boundary.normal, texZAxis);
             const auto [invertible, planeToWorldMatrix] = vm::invert(worldToPlaneMatrix); assert(invertible); unused(invertible);
             return planeToWorldMatrix * vm::mat4x4::zero_out<2>() * worldToPlaneMatrix;
@@ -559,22 +566,22 @@ namespace TrenchBroom {
 
         vm::mat4x4 BrushFace::toTexCoordSystemMatrix(const vm::vec2f& offset, const vm::vec2f& scale, const bool project) const {
             if (project) {
-                return vm::mat4x4::zero_out<2>() * m_texCoordSystem->toMatrix(offset, scale);
+                return vm::mat4x4::zero_out<2>() * texCoordSystem().toMatrix(offset, scale);
             } else {
-                return m_texCoordSystem->toMatrix(offset, scale);
+                return texCoordSystem().toMatrix(offset, scale);
             }
         }
 
         vm::mat4x4 BrushFace::fromTexCoordSystemMatrix(const vm::vec2f& offset, const vm::vec2f& scale, const bool project) const {
             if (project) {
-                return projectToBoundaryMatrix() * m_texCoordSystem->fromMatrix(offset, scale);
+                return projectToBoundaryMatrix() * texCoordSystem().fromMatrix(offset, scale);
             } else {
-                return m_texCoordSystem->fromMatrix(offset, scale);
+                return texCoordSystem().fromMatrix(offset, scale);
             }
         }
 
         float BrushFace::measureTextureAngle(const vm::vec2f& center, const vm::vec2f& point) const {
-            return m_texCoordSystem->measureAngle(m_attribs.rotation(), center, point);
+            return texCoordSystem().measureAngle(m_attribs.rotation(), center, point);
         }
 
         size_t BrushFace::vertexCount() const {
@@ -656,7 +663,11 @@ namespace TrenchBroom {
         }
 
         vm::vec2f BrushFace::textureCoords(const vm::vec3& point) const {
-            return m_texCoordSystem->getTexCoords(point, m_attribs);
+            return texCoordSystem().getTexCoords(point, m_attribs);
+        }
+
+        void BrushFace::textureCoords(const vm::vec3* points, const size_t count, vm::vec2f* result) const {
+            texCoordSystem().getTexCoords(points, count, m_attribs, result);
         }
 
         FloatType BrushFace::intersectWithRay(const vm::ray3& ray) const {
@@ -697,6 +708,14 @@ namespace TrenchBroom {
             }
         }
 
+        TexCoordSystem& BrushFace::texCoordSystem() {
+            return std::visit([](auto& texCoordSystem) -> TexCoordSystem& { return texCoordSystem; }, m_texCoordSystem);
+        }
+
+        const TexCoordSystem& BrushFace::texCoordSystem() const {
+            return std::visit([](const auto& texCoordSystem) -> const TexCoordSystem& { return texCoordSystem; }, m_texCoordSystem);
+        }
+
         void BrushFace::updateBrush() {
             if (m_brush != nullptr) {
                 m_brush->faceDidChange();
@@ -24,6 +24,8 @@
 #include "Macros.h"
 #include "Model/BrushFaceAttributes.h"
 #include "Model/BrushGeometry.h"
+#include "Model/ParallelTexCoordSystem.h"
+#include "Model/ParaxialTexCoordSystem.h"
 #include "Model/Tag.h" // BrushFace inherits from Taggable
 
 #include <kdl/transform_range.h>
@@ -34,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace TrenchBroom {
@@ -45,10 +48,15 @@ namespace TrenchBroom {
     namespace Model {
         class Brush;
         class BrushFaceSnapshot;
-        class TexCoordSystem;
         class TexCoordSystemSnapshot;
         enum class WrapStyle;
 
+        /**
+         * Holds the texture coordinate system of a brush face by value. Every face has one, so storing it inline saves
+         * a heap allocation and a pointer indirection per face compared to owning it through a pointer.
+         */
+        using TexCoordSystemStorage = std::variant<ParaxialTexCoordSystem, ParallelTexCoordSystem>;
+
         class BrushFace : public Taggable {
         public:
             /*
@@ -87,7 +95,7 @@ namespace TrenchBroom {
             size_t m_lineCount;
             bool m_selected;
 
-            std::unique_ptr<TexCoordSystem> m_texCoordSystem;
+            TexCoordSystemStorage m_texCoordSystem;
             BrushFaceGeometry* m_geometry;
 
             // brush renderer
@@ -95,7 +103,7 @@ namespace TrenchBroom {
         protected:
             BrushFaceAttributes m_attribs;
         public:
-            BrushFace(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const BrushFaceAttributes& attribs, std::unique_ptr<TexCoordSystem> texCoordSystem);
+            BrushFace(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const BrushFaceAttributes& attribs, TexCoordSystemStorage texCoordSystem);
 
             static BrushFace* createParaxial(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const std::string& textureName = "");
             static BrushFace* createParallel(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2, const std::string& textureName = "");
@@ -205,12 +213,20 @@ namespace TrenchBroom {
             void deselect();
 
             vm::vec2f textureCoords(const vm::vec3& point) const;
+            /**
+             * Computes the texture coordinates of the given number of points in one batch and stores them in the given
+             * result array. See TexCoordSystem::getTexCoords.
+             */
+            void textureCoords(const vm::vec3* points, size_t count, vm::vec2f* result) const;
 
             FloatType intersectWithRay(const vm::ray3& ray) const;
         private:
             void setPoints(const vm::vec3& point0, const vm::vec3& point1, const vm::vec3& point2);
             void correctPoints();
 
+            TexCoordSystem& texCoordSystem();
+            const TexCoordSystem& texCoordSystem() const;
+
             void updateBrush();
 
             // renderer cache
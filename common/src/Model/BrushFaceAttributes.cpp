@@ -29,7 +29,7 @@ namespace TrenchBroom {
         const std::string BrushFaceAttributes::NoTextureName = "__TB_empty";
 
         BrushFaceAttributes::BrushFaceAttributes(const std::string& textureName) :
-        m_textureName(textureName),
+        m_textureName(InternedString(textureName)),
         m_texture(nullptr),
         m_offset(vm::vec2f::zero()),
         m_scale(vm::vec2f(1.0f, 1.0f)),
@@ -54,7 +54,7 @@ namespace TrenchBroom {
         }
 
         BrushFaceAttributes::BrushFaceAttributes(const std::string& textureName, const BrushFaceAttributes& other) :
-        m_textureName(textureName),
+        m_textureName(InternedString(textureName)),
         m_texture(nullptr),
         m_offset(other.m_offset),
         m_scale(other.m_scale),
@@ -102,7 +102,7 @@ namespace TrenchBroom {
         }
 
         BrushFaceAttributes BrushFaceAttributes::takeSnapshot() const {
-            BrushFaceAttributes result(m_textureName);
+            BrushFaceAttributes result(textureName());
             result.m_offset = m_offset;
             result.m_scale = m_scale;
             result.m_rotation = m_rotation;
@@ -114,6 +114,10 @@ namespace TrenchBroom {
         }
 
         const std::string& BrushFaceAttributes::textureName() const {
+            return m_textureName.str();
+        }
+
+        const InternedString& BrushFaceAttributes::internedTextureName() const {
             return m_textureName;
         }
 
@@ -181,7 +185,7 @@ namespace TrenchBroom {
             m_texture = texture;
             if (m_texture != nullptr) {
                 m_texture->incUsageCount();
-                m_textureName = m_texture->name();
+                m_textureName = InternedString(m_texture->name());
             }
         }
 
@@ -190,7 +194,7 @@ namespace TrenchBroom {
                 m_texture->decUsageCount();
             }
             m_texture = nullptr;
-            m_textureName = BrushFaceAttributes::NoTextureName;
+            m_textureName = InternedString(BrushFaceAttributes::NoTextureName);
         }
 
         bool BrushFaceAttributes::valid() const {
@@ -277,6 +277,17 @@ namespace TrenchBroom {
             return result;
         }
 
+        TagDependency::Type ChangeBrushFaceAttributesRequest::tagDependencies() const {
+            auto result = TagDependency::None;
+            if (m_textureOp != TextureOp_None) {
+                result |= TagDependency::FaceTexture;
+            }
+            if (m_surfaceFlagsOp != FlagOp_None || m_contentFlagsOp != FlagOp_None || m_surfaceValueOp != ValueOp_None) {
+                result |= TagDependency::FaceFlags;
+            }
+            return result;
+        }
+
         void ChangeBrushFaceAttributesRequest::resetAll() {
             resetTextureAxes();
             setOffset(vm::vec2f::zero());
@@ -21,6 +21,7 @@
 #define TrenchBroom_ChangeBrushFaceAttributesRequest
 
 #include "Color.h"
+#include "Model/TagType.h"
 
 #include <vecmath/forward.h>
 
@@ -99,6 +100,12 @@ namespace TrenchBroom {
             const std::string name() const;
             bool evaluate(const std::vector<BrushFace*>& faces) const;
 
+            /**
+             * Returns the tag dependencies of the face properties that this request may change. The tags of the
+             * changed faces only need to be updated for matchers that depend on these properties.
+             */
+            TagDependency::Type tagDependencies() const;
+
             void resetAll();
 
             void setTexture(Assets::Texture* texture);
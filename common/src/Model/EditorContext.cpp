@@ -23,6 +23,7 @@
 #include "Assets/EntityDefinition.h"
 #include "Model/Brush.h"
 #include "Model/BrushFace.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/Entity.h"
 #include "Model/Group.h"
 #include "Model/Layer.h"
@@ -32,11 +33,42 @@
 
 namespace TrenchBroom {
     namespace Model {
+        namespace CachedState {
+            constexpr unsigned Visible    = 1u << 0;
+            constexpr unsigned Editable   = 1u << 1;
+            constexpr unsigned Pickable   = 1u << 2;
+            constexpr unsigned Selectable = 1u << 3;
+        }
+
+        template <typename Query>
+        bool EditorContext::cachedQuery(const Model::Node* node, const unsigned state, const Query& query) const {
+            const auto generation = EditorStateGeneration::current();
+            if (node->m_cachedEditorContext != this || node->m_cachedEditorStateGeneration != generation) {
+                node->m_cachedEditorContext = this;
+                node->m_cachedEditorStateGeneration = generation;
+                node->m_cachedEditorStateValid = 0u;
+                node->m_cachedEditorState = 0u;
+            }
+
+            if ((node->m_cachedEditorStateValid & state) == 0u) {
+                // the query may cache other states of the same node, so the cache must be updated afterwards
+                const auto result = query();
+                node->m_cachedEditorStateValid |= state;
+                if (result) {
+                    node->m_cachedEditorState |= state;
+                }
+                return result;
+            }
+
+            return (node->m_cachedEditorState & state) != 0u;
+        }
+
         EditorContext::EditorContext() {
             reset();
         }
 
         void EditorContext::reset() {
+            EditorStateGeneration::increment();
             m_showPointEntities = true;
             m_showBrushes = true;
             m_hiddenTags = 0;
@@ -53,6 +85,7 @@ namespace TrenchBroom {
         void EditorContext::setShowPointEntities(const bool showPointEntities) {
             if (showPointEntities != m_showPointEntities) {
                 m_showPointEntities = showPointEntities;
+                EditorStateGeneration::increment();
                 editorContextDidChangeNotifier();
             }
         }
@@ -64,6 +97,7 @@ namespace TrenchBroom {
         void EditorContext::setShowBrushes(const bool showBrushes) {
             if (showBrushes != m_showBrushes) {
                 m_showBrushes = showBrushes;
+                EditorStateGeneration::increment();
                 editorContextDidChangeNotifier();
             }
         }
@@ -75,6 +109,7 @@ namespace TrenchBroom {
         void EditorContext::setHiddenTags(const TagType::Type hiddenTags) {
             if (hiddenTags != m_hiddenTags) {
                 m_hiddenTags = hiddenTags;
+                EditorStateGeneration::increment();
                 editorContextDidChangeNotifier();
             }
         }
@@ -90,6 +125,7 @@ namespace TrenchBroom {
         void EditorContext::setEntityDefinitionHidden(const Assets::EntityDefinition* definition, const bool hidden) {
             if (definition != nullptr && entityDefinitionHidden(definition) != hidden) {
                 m_hiddenEntityDefinitions[definition->index()] = hidden;
+                EditorStateGeneration::increment();
                 editorContextDidChangeNotifier();
             }
         }
@@ -168,6 +204,18 @@ namespace TrenchBroom {
         }
 
         bool EditorContext::visible(const Model::Group* group) const {
+            return cachedQuery(group, CachedState::Visible, [&]() { return computeVisible(group); });
+        }
+
+        bool EditorContext::visible(const Model::Entity* entity) const {
+            return cachedQuery(entity, CachedState::Visible, [&]() { return computeVisible(entity); });
+        }
+
+        bool EditorContext::visible(const Model::Brush* brush) const {
+            return cachedQuery(brush, CachedState::Visible, [&]() { return computeVisible(brush); });
+        }
+
+        bool EditorContext::computeVisible(const Model::Group* group) const {
             if (group->selected()) {
                 return true;
             }
@@ -175,7 +223,7 @@ namespace TrenchBroom {
             return group->visible();
         }
 
-        bool EditorContext::visible(const Model::Entity* entity) const {
+        bool EditorContext::computeVisible(const Model::Entity* entity) const {
             if (entity->selected()) {
                 return true;
             }
@@ -202,7 +250,7 @@ namespace TrenchBroom {
             return true;
         }
 
-        bool EditorContext::visible(const Model::Brush* brush) const {
+        bool EditorContext::computeVisible(const Model::Brush* brush) const {
             if (brush->selected()) {
                 return true;
             }
@@ -236,7 +284,7 @@ namespace TrenchBroom {
         }
 
         bool EditorContext::editable(const Model::Node* node) const {
-            return node->editable();
+            return cachedQuery(node, CachedState::Editable, [&]() { return node->editable(); });
         }
 
         bool EditorContext::editable(const Model::BrushFace* face) const {
@@ -271,25 +319,37 @@ namespace TrenchBroom {
         }
 
         bool EditorContext::pickable(const Model::Group* group) const {
-            return visible(group) && !group->opened() && group->groupOpened();
+            return cachedQuery(group, CachedState::Pickable, [&]() { return computePickable(group); });
         }
 
         bool EditorContext::pickable(const Model::Entity* entity) const {
+            return cachedQuery(entity, CachedState::Pickable, [&]() { return computePickable(entity); });
+        }
+
+        bool EditorContext::pickable(const Model::Brush* brush) const {
+            return cachedQuery(brush, CachedState::Pickable, [&]() { return computePickable(brush); });
+        }
+
+        bool EditorContext::pickable(const Model::BrushFace* face) const {
+            return face->brush()->selected() || visible(face);
+        }
+
+        bool EditorContext::computePickable(const Model::Group* group) const {
+            return visible(group) && !group->opened() && group->groupOpened();
+        }
+
+        bool EditorContext::computePickable(const Model::Entity* entity) const {
             // Do not check whether this is an open group or not -- we must be able
             // to pick objects within groups in order to draw on them etc.
             return visible(entity) && !entity->hasChildren();
         }
 
-        bool EditorContext::pickable(const Model::Brush* brush) const {
+        bool EditorContext::computePickable(const Model::Brush* brush) const {
             // Do not check whether this is an open group or not -- we must be able
             // to pick objects within groups in order to draw on them etc.
             return visible(brush);
         }
 
-        bool EditorContext::pickable(const Model::BrushFace* face) const {
-            return face->brush()->selected() || visible(face);
-        }
-
         class NodeSelectable : public Model::ConstNodeVisitor, public Model::NodeQuery<bool> {
         private:
             const EditorContext& m_this;
@@ -318,21 +378,33 @@ namespace TrenchBroom {
         }
 
         bool EditorContext::selectable(const Model::Group* group) const {
-            return visible(group) && editable(group) && pickable(group) && inOpenGroup(group);
+            return cachedQuery(group, CachedState::Selectable, [&]() { return computeSelectable(group); });
         }
 
         bool EditorContext::selectable(const Model::Entity* entity) const {
-            return visible(entity) && editable(entity) && pickable(entity) && inOpenGroup(entity);
+            return cachedQuery(entity, CachedState::Selectable, [&]() { return computeSelectable(entity); });
         }
 
         bool EditorContext::selectable(const Model::Brush* brush) const {
-            return visible(brush) && editable(brush) && pickable(brush) && inOpenGroup(brush);
+            return cachedQuery(brush, CachedState::Selectable, [&]() { return computeSelectable(brush); });
         }
 
         bool EditorContext::selectable(const Model::BrushFace* face) const {
             return visible(face) && editable(face) && pickable(face);
         }
 
+        bool EditorContext::computeSelectable(const Model::Group* group) const {
+            return visible(group) && editable(group) && pickable(group) && inOpenGroup(group);
+        }
+
+        bool EditorContext::computeSelectable(const Model::Entity* entity) const {
+            return visible(entity) && editable(entity) && pickable(entity) && inOpenGroup(entity);
+        }
+
+        bool EditorContext::computeSelectable(const Model::Brush* brush) const {
+            return visible(brush) && editable(brush) && pickable(brush) && inOpenGroup(brush);
+        }
+
         bool EditorContext::canChangeSelection() const {
             return !m_blockSelection;
         }
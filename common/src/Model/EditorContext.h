@@ -41,6 +41,13 @@ namespace TrenchBroom {
         class Object;
         class World;
 
+        /**
+         * Decides whether nodes and brush faces are visible, editable, pickable and selectable.
+         *
+         * The results of the node queries are cached in the nodes themselves and remain valid until the editor state
+         * generation changes, see EditorStateGeneration. This turns repeated queries, e.g. by the renderer, into bit
+         * tests.
+         */
         class EditorContext {
         public:
             typedef enum {
@@ -97,6 +104,9 @@ namespace TrenchBroom {
             bool visible(const Model::Brush* brush) const;
             bool visible(const Model::BrushFace* face) const;
         private:
+            bool computeVisible(const Model::Group* group) const;
+            bool computeVisible(const Model::Entity* entity) const;
+            bool computeVisible(const Model::Brush* brush) const;
             bool anyChildVisible(const Model::Node* node) const;
 
         public:
@@ -113,6 +123,11 @@ namespace TrenchBroom {
             bool pickable(const Model::Entity* entity) const;
             bool pickable(const Model::Brush* brush) const;
             bool pickable(const Model::BrushFace* face) const;
+        private:
+            bool computePickable(const Model::Group* group) const;
+            bool computePickable(const Model::Entity* entity) const;
+            bool computePickable(const Model::Brush* brush) const;
+        public:
 
             bool selectable(const Model::Node* node) const;
             bool selectable(const Model::World* world) const;
@@ -121,9 +136,16 @@ namespace TrenchBroom {
             bool selectable(const Model::Entity* entity) const;
             bool selectable(const Model::Brush* brush) const;
             bool selectable(const Model::BrushFace* face) const;
-
+        private:
+            bool computeSelectable(const Model::Group* group) const;
+            bool computeSelectable(const Model::Entity* entity) const;
+            bool computeSelectable(const Model::Brush* brush) const;
+        public:
             bool canChangeSelection() const;
             bool inOpenGroup(const Model::Object* object) const;
+        private:
+            template <typename Query>
+            bool cachedQuery(const Model::Node* node, unsigned state, const Query& query) const;
         private:
             EditorContext(const EditorContext&);
             EditorContext& operator=(const EditorContext&);
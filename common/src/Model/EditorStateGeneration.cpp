@@ -0,0 +1,38 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EditorStateGeneration.h"
+
+#include <atomic>
+
+namespace TrenchBroom {
+    namespace Model {
+        namespace EditorStateGeneration {
+            static std::atomic<std::size_t> s_generation{1u};
+
+            std::size_t current() {
+                return s_generation.load(std::memory_order_relaxed);
+            }
+
+            void increment() {
+                s_generation.fetch_add(1u, std::memory_order_relaxed);
+            }
+        }
+    }
+}
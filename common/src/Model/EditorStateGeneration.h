@@ -0,0 +1,48 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRENCHBROOM_EDITORSTATEGENERATION_H
+#define TRENCHBROOM_EDITORSTATEGENERATION_H
+
+#include <cstddef>
+
+namespace TrenchBroom {
+    namespace Model {
+        /**
+         * A global counter that is incremented whenever a property changes that affects whether a node is visible,
+         * editable, pickable or selectable, such as the visibility, lock or selection state of a node, the node
+         * hierarchy, the tags of a node or brush face, or the settings of an editor context.
+         *
+         * The EditorContext caches its query results per node and discards them once the generation has changed.
+         */
+        namespace EditorStateGeneration {
+            /**
+             * Returns the current generation. The first generation is 1.
+             */
+            std::size_t current();
+
+            /**
+             * Increments the current generation, invalidating all cached query results.
+             */
+            void increment();
+        }
+    }
+}
+
+#endif //TRENCHBROOM_EDITORSTATEGENERATION_H
@@ -74,7 +74,7 @@ namespace TrenchBroom {
         m_definition(nullptr) {}
 
         EntityAttribute::EntityAttribute(const std::string& name, const std::string& value, const Assets::AttributeDefinition* definition) :
-        m_name(name),
+        m_name(InternedString(name)),
         m_value(value),
         m_definition(definition) {}
 
@@ -83,14 +83,14 @@ namespace TrenchBroom {
         }
 
         int EntityAttribute::compare(const EntityAttribute& rhs) const {
-            const int nameCmp = m_name.compare(rhs.m_name);
+            const int nameCmp = m_name != rhs.m_name ? m_name.str().compare(rhs.m_name.str()) : 0;
             if (nameCmp != 0)
                 return nameCmp;
             return m_value.compare(rhs.m_value);
         }
 
         const std::string& EntityAttribute::name() const {
-            return m_name;
+            return m_name.str();
         }
 
         const std::string& EntityAttribute::value() const {
@@ -102,7 +102,7 @@ namespace TrenchBroom {
         }
 
         bool EntityAttribute::hasName(const std::string_view name) const {
-            return kdl::cs::str_is_equal(m_name, name);
+            return m_name == name;
         }
 
         bool EntityAttribute::hasValue(const std::string_view value) const {
@@ -114,7 +114,7 @@ namespace TrenchBroom {
         }
 
         bool EntityAttribute::hasPrefix(const std::string_view prefix) const {
-            return kdl::cs::str_is_prefix(m_name, prefix);
+            return kdl::cs::str_is_prefix(m_name.str(), prefix);
         }
 
         bool EntityAttribute::hasPrefixAndValue(const std::string_view prefix, const std::string_view value) const {
@@ -122,7 +122,7 @@ namespace TrenchBroom {
         }
 
         bool EntityAttribute::hasNumberedPrefix(const std::string_view prefix) const {
-            return isNumberedAttribute(prefix, m_name);
+            return isNumberedAttribute(prefix, m_name.str());
         }
 
         bool EntityAttribute::hasNumberedPrefixAndValue(const std::string_view prefix, const std::string_view value) const {
@@ -130,7 +130,7 @@ namespace TrenchBroom {
         }
 
         void EntityAttribute::setName(const std::string& name, const Assets::AttributeDefinition* definition) {
-            m_name = name;
+            m_name = InternedString(name);
             m_definition = definition;
         }
 
@@ -20,6 +20,8 @@
 #ifndef TrenchBroom_EntityProperties
 #define TrenchBroom_EntityProperties
 
+#include "InternedString.h"
+
 #include <string>
 #include <vector>
 
@@ -70,7 +72,7 @@ namespace TrenchBroom {
 
         class EntityAttribute {
         private:
-            std::string m_name;
+            InternedString m_name;
             std::string m_value;
             const Assets::AttributeDefinition* m_definition;
         public:
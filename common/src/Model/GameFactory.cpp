@@ -78,7 +78,8 @@ namespace TrenchBroom {
         }
 
         std::shared_ptr<Game> GameFactory::createGame(const std::string& gameName, Logger& logger) {
-            return std::make_shared<GameImpl>(gameConfig(gameName), gamePath(gameName), logger);
+            const auto mountCachePath = IO::SystemPaths::userDataDirectory() + IO::Path("cache") + IO::Path(gameName + ".mounts");
+            return std::make_shared<GameImpl>(gameConfig(gameName), gamePath(gameName), mountCachePath, logger);
         }
 
         std::vector<std::string> GameFactory::fileFormats(const std::string& gameName) const {
@@ -26,6 +26,7 @@
 #include "IO/DkPakFileSystem.h"
 #include "IO/IdPakFileSystem.h"
 #include "IO/FileMatcher.h"
+#include "IO/MountCache.h"
 #include "IO/Quake3ShaderFileSystem.h"
 #include "IO/ZipFileSystem.h"
 #include "Model/GameConfig.h"
@@ -41,7 +42,7 @@ namespace TrenchBroom {
         FileSystem(),
         m_shaderFS(nullptr) {}
 
-        void GameFileSystem::initialize(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, Logger& logger) {
+        void GameFileSystem::initialize(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, const IO::Path& mountCachePath, Logger& logger) {
             // delete the existing file system
             releaseNext();
             m_shaderFS = nullptr;
@@ -49,12 +50,24 @@ namespace TrenchBroom {
             addDefaultAssetPath(config, logger);
 
             if (!gamePath.isEmpty() && IO::Disk::directoryExists(gamePath)) {
-                addGameFileSystems(config, gamePath, additionalSearchPaths, logger);
+                auto mountCache = mountCachePath.isEmpty() ? IO::MountCache() : IO::MountCache::read(mountCachePath);
+                addGameFileSystems(config, gamePath, additionalSearchPaths, mountCachePath.isEmpty() ? nullptr : &mountCache, logger);
                 addShaderFileSystem(config, logger);
+
+                if (mountCache.modified()) {
+                    try {
+                        mountCache.write(mountCachePath);
+                    } catch (const FileSystemException& e) {
+                        logger.warn() << "Could not write mount cache: " << e.what();
+                    }
+                }
             }
+
+            buildIndex();
         }
 
         void GameFileSystem::reloadShaders() {
+            // the shader file system is never indexed, so the index of the other file systems remains valid
             if (m_shaderFS != nullptr) {
                 m_shaderFS->reload();
             }
@@ -71,14 +84,14 @@ namespace TrenchBroom {
             }
         }
 
-        void GameFileSystem::addGameFileSystems(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, Logger& logger) {
+        void GameFileSystem::addGameFileSystems(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, IO::MountCache* mountCache, Logger& logger) {
             const auto& fileSystemConfig = config.fileSystemConfig();
             addFileSystemPath(gamePath + fileSystemConfig.searchPath, logger);
-            addFileSystemPackages(config, gamePath + fileSystemConfig.searchPath, logger);
+            addFileSystemPackages(config, gamePath + fileSystemConfig.searchPath, mountCache, logger);
 
             for (const auto& searchPath : additionalSearchPaths) {
                 addFileSystemPath(gamePath + searchPath, logger);
-                addFileSystemPackages(config, gamePath + searchPath, logger);
+                addFileSystemPackages(config, gamePath + searchPath, mountCache, logger);
             }
         }
 
@@ -91,7 +104,7 @@ namespace TrenchBroom {
             }
         }
 
-        void GameFileSystem::addFileSystemPackages(const GameConfig& config, const IO::Path& searchPath, Logger& logger) {
+        void GameFileSystem::addFileSystemPackages(const GameConfig& config, const IO::Path& searchPath, IO::MountCache* mountCache, Logger& logger) {
             const auto& fileSystemConfig = config.fileSystemConfig();
             const auto& packageFormatConfig = fileSystemConfig.packageFormat;
 
@@ -107,13 +120,13 @@ namespace TrenchBroom {
                     try {
                         if (kdl::ci::str_is_equal(packageFormat, "idpak")) {
                             logger.info() << "Adding file system package " << packagePath;
-                            m_next = std::make_shared<IO::IdPakFileSystem>(m_next, diskFS.makeAbsolute(packagePath));
+                            m_next = std::make_shared<IO::IdPakFileSystem>(m_next, diskFS.makeAbsolute(packagePath), mountCache);
                         } else if (kdl::ci::str_is_equal(packageFormat, "dkpak")) {
                             logger.info() << "Adding file system package " << packagePath;
-                            m_next = std::make_shared<IO::DkPakFileSystem>(m_next, diskFS.makeAbsolute(packagePath));
+                            m_next = std::make_shared<IO::DkPakFileSystem>(m_next, diskFS.makeAbsolute(packagePath), mountCache);
                         } else if (kdl::ci::str_is_equal(packageFormat, "zip")) {
                             logger.info() << "Adding file system package " << packagePath;
-                            m_next = std::make_shared<IO::ZipFileSystem>(m_next, diskFS.makeAbsolute(packagePath));
+                            m_next = std::make_shared<IO::ZipFileSystem>(m_next, diskFS.makeAbsolute(packagePath), mountCache);
                         }
                     } catch (const std::exception& e) {
                         logger.error() << e.what();
@@ -29,6 +29,7 @@ namespace TrenchBroom {
     class Logger;
 
     namespace IO {
+        class MountCache;
         class Path;
         class Quake3ShaderFileSystem;
     }
@@ -41,14 +42,19 @@ namespace TrenchBroom {
             IO::Quake3ShaderFileSystem* m_shaderFS;
         public:
             GameFileSystem();
-            void initialize(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, Logger& logger);
+
+            /**
+             * Mounts the file systems for the given game configuration. If the given mount cache path is not empty, the
+             * directories of the mounted packages are read from and written to the mount cache at that path.
+             */
+            void initialize(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, const IO::Path& mountCachePath, Logger& logger);
             void reloadShaders();
         private:
             void addDefaultAssetPath(const GameConfig& config, Logger& logger);
-            void addGameFileSystems(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, Logger& logger);
+            void addGameFileSystems(const GameConfig& config, const IO::Path& gamePath, const std::vector<IO::Path>& additionalSearchPaths, IO::MountCache* mountCache, Logger& logger);
             void addShaderFileSystem(const GameConfig& config, Logger& logger);
             void addFileSystemPath(const IO::Path& path, Logger& logger);
-            void addFileSystemPackages(const GameConfig& config, const IO::Path& searchPath, Logger& logger);
+            void addFileSystemPackages(const GameConfig& config, const IO::Path& searchPath, IO::MountCache* mountCache, Logger& logger);
         private:
             bool doDirectoryExists(const IO::Path& path) const override;
             bool doFileExists(const IO::Path& path) const override;
@@ -32,6 +32,7 @@
 #include "IO/DiskIO.h"
 #include "IO/DkmParser.h"
 #include "IO/DiskFileSystem.h"
+#include "IO/EntityDefinitionCache.h"
 #include "IO/EntParser.h"
 #include "IO/FgdParser.h"
 #include "IO/File.h"
@@ -63,18 +64,23 @@
 #include <kdl/vector_utils.h>
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace TrenchBroom {
     namespace Model {
         GameImpl::GameImpl(GameConfig& config, const IO::Path& gamePath, Logger& logger) :
+        GameImpl(config, gamePath, IO::Path(), logger) {}
+
+        GameImpl::GameImpl(GameConfig& config, const IO::Path& gamePath, const IO::Path& mountCachePath, Logger& logger) :
         m_config(config),
-        m_gamePath(gamePath) {
+        m_gamePath(gamePath),
+        m_mountCachePath(mountCachePath) {
             initializeFileSystem(logger);
         }
 
         void GameImpl::initializeFileSystem(Logger& logger) {
-            m_fs.initialize(m_config, m_gamePath, m_additionalSearchPaths, logger);
+            m_fs.initialize(m_config, m_gamePath, m_additionalSearchPaths, m_mountCachePath, logger);
         }
 
         const std::string& GameImpl::doGameName() const {
@@ -294,23 +300,41 @@ namespace TrenchBroom {
             const auto extension = path.extension();
             const auto& defaultColor = m_config.entityConfig().defaultColor;
 
-            if (kdl::ci::str_is_equal("fgd", extension)) {
-                auto file = IO::Disk::openFile(IO::Disk::fixPath(path));
-                auto reader = file->reader().buffer();
+            const auto isFgd = kdl::ci::str_is_equal("fgd", extension);
+            const auto isDef = kdl::ci::str_is_equal("def", extension);
+            const auto isEnt = kdl::ci::str_is_equal("ent", extension);
+            if (!isFgd && !isDef && !isEnt) {
+                throw GameException("Unknown entity definition format: '" + path.asString() + "'");
+            }
+
+            auto file = IO::Disk::openFile(IO::Disk::fixPath(path));
+            auto reader = file->reader().buffer();
+            const auto contents = std::string_view(reader.begin(), reader.size());
+
+            // only parse the file again if it or one of its included files has changed since it was last parsed
+            auto& cache = IO::EntityDefinitionCache::instance();
+            if (auto cachedDefinitions = cache.find(file->path(), contents, defaultColor)) {
+                status.debug("Using cached entity definitions for '" + file->path().asString() + "'");
+                return std::move(*cachedDefinitions);
+            }
+
+            if (isFgd) {
                 IO::FgdParser parser(std::begin(reader), std::end(reader), defaultColor, file->path());
-                return parser.parseDefinitions(status);
-            } else if (kdl::ci::str_is_equal("def", extension)) {
-                auto file = IO::Disk::openFile(IO::Disk::fixPath(path));
-                auto reader = file->reader().buffer();
+                auto definitions = parser.parseDefinitions(status);
+                if (!parser.includeFailed()) {
+                    cache.put(file->path(), contents, parser.includedPaths(), defaultColor, definitions);
+                }
+                return definitions;
+            } else if (isDef) {
                 IO::DefParser parser(std::begin(reader), std::end(reader), defaultColor);
-                return parser.parseDefinitions(status);
-            } else if (kdl::ci::str_is_equal("ent", extension)) {
-                auto file = IO::Disk::openFile(IO::Disk::fixPath(path));
-                auto reader = file->reader().buffer();
-                IO::EntParser parser(std::begin(reader), std::end(reader), defaultColor);
-                return parser.parseDefinitions(status);
+                auto definitions = parser.parseDefinitions(status);
+                cache.put(file->path(), contents, {}, defaultColor, definitions);
+                return definitions;
             } else {
-                throw GameException("Unknown entity definition format: '" + path.asString() + "'");
+                IO::EntParser parser(std::begin(reader), std::end(reader), defaultColor);
+                auto definitions = parser.parseDefinitions(status);
+                cache.put(file->path(), contents, {}, defaultColor, definitions);
+                return definitions;
             }
         }
 
@@ -43,8 +43,15 @@ namespace TrenchBroom {
             GameFileSystem m_fs;
             IO::Path m_gamePath;
             std::vector<IO::Path> m_additionalSearchPaths;
+            IO::Path m_mountCachePath;
         public:
             GameImpl(GameConfig& config, const IO::Path& gamePath, Logger& logger);
+
+            /**
+             * Creates a game whose file system stores the directories of mounted packages in the mount cache at the
+             * given path.
+             */
+            GameImpl(GameConfig& config, const IO::Path& gamePath, const IO::Path& mountCachePath, Logger& logger);
         private:
             void initializeFileSystem(Logger& logger);
         private:
@@ -24,6 +24,7 @@
 #include "Model/BoundsIntersectsNodeVisitor.h"
 #include "Model/Brush.h"
 #include "Model/ComputeNodeBoundsVisitor.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/Entity.h"
 #include "Model/FindContainerVisitor.h"
 #include "Model/FindGroupVisitor.h"
@@ -69,6 +70,7 @@ namespace TrenchBroom {
 
         void Group::setEditState(const EditState editState) {
             m_editState = editState;
+            EditorStateGeneration::increment();
         }
 
         class Group::SetEditStateVisitor : public NodeVisitor {
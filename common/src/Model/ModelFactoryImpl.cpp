@@ -73,10 +73,10 @@ namespace TrenchBroom {
             assert(m_format != MapFormat::Unknown);
             if (m_format == MapFormat::Valve) {
                 return new BrushFace(point1, point2, point3, attribs,
-                                     std::make_unique<ParallelTexCoordSystem>(point1, point2, point3, attribs));
+                                     ParallelTexCoordSystem(point1, point2, point3, attribs));
             } else {
                 return new BrushFace(point1, point2, point3, attribs,
-                                     std::make_unique<ParaxialTexCoordSystem>(point1, point2, point3, attribs));
+                                     ParaxialTexCoordSystem(point1, point2, point3, attribs));
             }
         }
 
@@ -84,10 +84,10 @@ namespace TrenchBroom {
             assert(m_format != MapFormat::Unknown);
             if (m_format == MapFormat::Valve) {
                 return new BrushFace(point1, point2, point3, attribs,
-                                     std::make_unique<ParallelTexCoordSystem>(texAxisX, texAxisY));
+                                     ParallelTexCoordSystem(texAxisX, texAxisY));
             } else {
                 return new BrushFace(point1, point2, point3, attribs,
-                                     std::make_unique<ParaxialTexCoordSystem>(point1, point2, point3, attribs));
+                                     ParaxialTexCoordSystem(point1, point2, point3, attribs));
             }
         }
     }
@@ -21,6 +21,7 @@
 
 #include "Ensure.h"
 #include "Macros.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/Issue.h"
 #include "Model/IssueGenerator.h"
 #include "Model/LockState.h"
@@ -48,7 +49,11 @@ namespace TrenchBroom {
         m_lineNumber(0),
         m_lineCount(0),
         m_issuesValid(false),
-        m_hiddenIssues(0) {}
+        m_hiddenIssues(0),
+        m_cachedEditorContext(nullptr),
+        m_cachedEditorStateGeneration(0u),
+        m_cachedEditorStateValid(0u),
+        m_cachedEditorState(0u) {}
 
         Node::~Node() {
             clearChildren();
@@ -302,6 +307,7 @@ namespace TrenchBroom {
 
             parentWillChange();
             m_parent = parent;
+            EditorStateGeneration::increment();
             parentDidChange();
         }
 
@@ -413,6 +419,7 @@ namespace TrenchBroom {
                 return;
             assert(!m_selected);
             m_selected = true;
+            EditorStateGeneration::increment();
             if (m_parent != nullptr)
                 m_parent->childWasSelected();
         }
@@ -422,6 +429,7 @@ namespace TrenchBroom {
                 return;
             assert(m_selected);
             m_selected = false;
+            EditorStateGeneration::increment();
             if (m_parent != nullptr)
                 m_parent->childWasDeselected();
         }
@@ -530,6 +538,7 @@ namespace TrenchBroom {
         bool Node::setVisibilityState(const VisibilityState visibility) {
             if (visibility != m_visibilityState) {
                 m_visibilityState = visibility;
+                EditorStateGeneration::increment();
                 return true;
             }
             return false;
@@ -564,6 +573,7 @@ namespace TrenchBroom {
         bool Node::setLockState(const LockState lockState) {
             if (lockState != m_lockState) {
                 m_lockState = lockState;
+                EditorStateGeneration::increment();
                 return true;
             }
             return false;
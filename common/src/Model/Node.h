@@ -33,6 +33,7 @@ namespace TrenchBroom {
     namespace Model {
         class AttributableNode;
         class ConstNodeVisitor;
+        class EditorContext;
         class Issue;
         class IssueGenerator;
         enum class LockState;
@@ -60,6 +61,16 @@ namespace TrenchBroom {
             mutable std::vector<Issue*> m_issues;
             mutable bool m_issuesValid;
             IssueType m_hiddenIssues;
+
+            /**
+             * The results of EditorContext queries for this node. They are valid for the given editor context as long
+             * as the editor state generation has not changed, see EditorStateGeneration.
+             */
+            friend class EditorContext;
+            mutable const EditorContext* m_cachedEditorContext;
+            mutable size_t m_cachedEditorStateGeneration;
+            mutable unsigned m_cachedEditorStateValid;
+            mutable unsigned m_cachedEditorState;
         protected:
             Node();
         private:
@@ -0,0 +1,175 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TrenchBroom_PackedPlanes_h
+#define TrenchBroom_PackedPlanes_h
+
+#include <vecmath/plane.h>
+#include <vecmath/ray.h>
+#include <vecmath/scalar.h>
+#include <vecmath/vec.h>
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        /**
+         * Stores the planes bounding a convex volume, such as the faces of a brush, in contiguous arrays, one per
+         * plane component. This allows point containment and ray intersection queries to be answered in a single loop
+         * over all planes without having to follow pointers, which the compiler can vectorize.
+         *
+         * The four arrays are consecutive ranges of a single allocation: all normal x components, followed by all
+         * normal y components, all normal z components and finally all distances.
+         *
+         * The normals of the planes must point out of the volume.
+         *
+         * @tparam T the component type
+         */
+        template <typename T>
+        class PackedPlanes {
+        private:
+            std::size_t m_size = 0u;
+            std::vector<T> m_components;
+        public:
+            PackedPlanes() = default;
+
+            /**
+             * Creates a new instance containing the given planes. The planes may have a different component type, in
+             * which case they are converted.
+             */
+            template <typename P>
+            explicit PackedPlanes(const std::vector<vm::plane<P,3>>& planes) :
+            m_size(planes.size()),
+            m_components(4u * planes.size()) {
+                auto* normalX = m_components.data();
+                auto* normalY = normalX + m_size;
+                auto* normalZ = normalY + m_size;
+                auto* distance = normalZ + m_size;
+
+                for (std::size_t i = 0u; i < m_size; ++i) {
+                    normalX[i] = static_cast<T>(planes[i].normal.x());
+                    normalY[i] = static_cast<T>(planes[i].normal.y());
+                    normalZ[i] = static_cast<T>(planes[i].normal.z());
+                    distance[i] = static_cast<T>(planes[i].distance);
+                }
+            }
+
+            std::size_t size() const {
+                return m_size;
+            }
+
+            bool empty() const {
+                return m_size == 0u;
+            }
+
+            /**
+             * Returns the plane with the given index.
+             */
+            vm::plane<T,3> plane(const std::size_t index) const {
+                return vm::plane<T,3>(distances()[index], vm::vec<T,3>(normalXs()[index], normalYs()[index], normalZs()[index]));
+            }
+
+            /**
+             * Indicates whether the given point is not above any of the planes, i.e., whether it is contained in the
+             * volume bounded by the planes.
+             *
+             * @param point the point to test
+             * @param epsilon the distance above a plane up to which a point is still considered to be on the plane
+             * @return true if the given point is contained in the volume and false otherwise
+             */
+            bool contains(const vm::vec<T,3>& point, const T epsilon = vm::constants<T>::point_status_epsilon()) const {
+                const auto* nx = normalXs();
+                const auto* ny = normalYs();
+                const auto* nz = normalZs();
+                const auto* d = distances();
+
+                auto result = true;
+                for (std::size_t i = 0u; i < m_size; ++i) {
+                    const auto distance = nx[i] * point.x() + ny[i] * point.y() + nz[i] * point.z() - d[i];
+                    result &= (distance <= epsilon);
+                }
+                return result;
+            }
+
+            /**
+             * Computes the distance at which the given ray enters the volume bounded by the planes by clipping the ray
+             * against every plane.
+             *
+             * The ray enters the volume through the plane that it enters last among the planes facing it, and it leaves
+             * the volume through the plane that it leaves first among the planes facing away from it. The ray hits the
+             * volume if it enters it before leaving it and if it does not start inside of the volume.
+             *
+             * @param ray the ray to intersect
+             * @return a pair containing the entry distance and the index of the plane through which the ray enters the
+             * volume, or NaN and the number of planes if the ray does not hit the volume
+             */
+            std::pair<T, std::size_t> intersectWithRay(const vm::ray<T,3>& ray) const {
+                constexpr auto Infinity = std::numeric_limits<T>::infinity();
+
+                auto entry = -Infinity;
+                auto exit = Infinity;
+                auto entryIndex = size();
+                auto parallelAndAbove = false;
+
+                const auto* nx = normalXs();
+                const auto* ny = normalYs();
+                const auto* nz = normalZs();
+                const auto* d = distances();
+
+                for (std::size_t i = 0u; i < m_size; ++i) {
+                    const auto cos = nx[i] * ray.direction.x() + ny[i] * ray.direction.y() + nz[i] * ray.direction.z();
+                    const auto distance = nx[i] * ray.origin.x() + ny[i] * ray.origin.y() + nz[i] * ray.origin.z() - d[i];
+                    const auto t = -distance / cos;
+
+                    const auto enters = cos < static_cast<T>(0) && t > entry;
+                    entryIndex = enters ? i : entryIndex;
+                    entry = enters ? t : entry;
+                    exit = cos > static_cast<T>(0) && t < exit ? t : exit;
+                    parallelAndAbove |= (cos == static_cast<T>(0) && distance > static_cast<T>(0));
+                }
+
+                if (parallelAndAbove || entryIndex == size() || entry < static_cast<T>(0) || entry > exit) {
+                    return { vm::nan<T>(), size() };
+                }
+                return { entry, entryIndex };
+            }
+        private:
+            const T* normalXs() const {
+                return m_components.data();
+            }
+
+            const T* normalYs() const {
+                return m_components.data() + m_size;
+            }
+
+            const T* normalZs() const {
+                return m_components.data() + 2u * m_size;
+            }
+
+            const T* distances() const {
+                return m_components.data() + 3u * m_size;
+            }
+        };
+    }
+}
+
+#endif
@@ -116,6 +116,10 @@ namespace TrenchBroom {
             return (computeTexCoords(point, attribs.scale()) + attribs.offset()) / attribs.textureSize();
         }
 
+        void ParallelTexCoordSystem::doGetTexCoords(const vm::vec3* points, const size_t count, const BrushFaceAttributes& attribs, vm::vec2f* result) const {
+            computeTexCoords(points, count, attribs, result);
+        }
+
         /**
          * Rotates from `oldAngle` to `newAngle`. Both of these are in CCW degrees about
          * the texture normal (`getZAxis()`). The provided `normal` is ignored.
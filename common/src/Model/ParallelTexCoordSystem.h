@@ -69,6 +69,7 @@ namespace TrenchBroom {
 
             bool isRotationInverted(const vm::vec3& normal) const override;
             vm::vec2f doGetTexCoords(const vm::vec3& point, const BrushFaceAttributes& attribs) const override;
+            void doGetTexCoords(const vm::vec3* points, size_t count, const BrushFaceAttributes& attribs, vm::vec2f* result) const override;
 
             void doSetRotation(const vm::vec3& normal, float oldAngle, float newAngle) override;
             void applyRotation(const vm::vec3& normal, FloatType angle);
@@ -84,7 +85,7 @@ namespace TrenchBroom {
             float doMeasureAngle(float currentAngle, const vm::vec2f& center, const vm::vec2f& point) const override;
             void computeInitialAxes(const vm::vec3& normal, vm::vec3& xAxis, vm::vec3& yAxis) const;
 
-            deleteCopyAndMove(ParallelTexCoordSystem)
+            defineCopyAndMove(ParallelTexCoordSystem)
         };
     }
 }
@@ -120,6 +120,10 @@ namespace TrenchBroom {
             return (computeTexCoords(point, attribs.scale()) + attribs.offset()) / attribs.textureSize();
         }
 
+        void ParaxialTexCoordSystem::doGetTexCoords(const vm::vec3* points, const size_t count, const BrushFaceAttributes& attribs, vm::vec2f* result) const {
+            computeTexCoords(points, count, attribs, result);
+        }
+
         void ParaxialTexCoordSystem::doSetRotation(const vm::vec3& normal, const float /* oldAngle */, const float newAngle) {
             m_index = planeNormalIndex(normal);
             axes(m_index, m_xAxis, m_yAxis);
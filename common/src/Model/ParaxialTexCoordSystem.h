@@ -61,6 +61,7 @@ namespace TrenchBroom {
 
             bool isRotationInverted(const vm::vec3& normal) const override;
             vm::vec2f doGetTexCoords(const vm::vec3& point, const BrushFaceAttributes& attribs) const override;
+            void doGetTexCoords(const vm::vec3* points, size_t count, const BrushFaceAttributes& attribs, vm::vec2f* result) const override;
 
             void doSetRotation(const vm::vec3& normal, float oldAngle, float newAngle) override;
             void doTransform(const vm::plane3& oldBoundary, const vm::plane3& newBoundary, const vm::mat4x4& transformation, BrushFaceAttributes& attribs, bool lockTexture, const vm::vec3& invariant) override;
@@ -74,7 +75,7 @@ namespace TrenchBroom {
         private:
             void rotateAxes(vm::vec3& xAxis, vm::vec3& yAxis, FloatType angleInRadians, size_t planeNormIndex) const;
 
-            deleteCopyAndMove(ParaxialTexCoordSystem)
+            defineCopyAndMove(ParaxialTexCoordSystem)
         };
     }
 }
@@ -0,0 +1,108 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlanePointStatus.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TB_POINTSTATUS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace TrenchBroom {
+    namespace Model {
+        static_assert(sizeof(vm::vec<double,3>) == 3u * sizeof(double), "vm::vec3d must be tightly packed");
+
+        [[maybe_unused]] static std::size_t countBits(const int mask) {
+            std::size_t result = 0u;
+            for (int m = mask; m != 0; m >>= 1) {
+                result += static_cast<std::size_t>(m & 1);
+            }
+            return result;
+        }
+
+        /*
+         * Every lane computes the signed distance exactly like vm::plane::point_distance, i.e., the dot product of the
+         * point and the plane normal, accumulated starting from zero, minus the plane distance. The comparisons against
+         * the epsilon are then the same as in vm::plane::point_status, so the classification is identical. NaN
+         * distances compare false in both directions and are therefore counted as inside, as in the scalar version.
+         */
+        PointStatusCounts countPointStatus(const vm::plane<double,3>& plane, const vm::vec<double,3>* points, const std::size_t count, const double epsilon) {
+            PointStatusCounts result;
+
+            std::size_t i = 0u;
+#if defined(__AVX__)
+            const auto nx = _mm256_set1_pd(plane.normal.x());
+            const auto ny = _mm256_set1_pd(plane.normal.y());
+            const auto nz = _mm256_set1_pd(plane.normal.z());
+            const auto d = _mm256_set1_pd(plane.distance);
+            const auto pe = _mm256_set1_pd(epsilon);
+            const auto me = _mm256_set1_pd(-epsilon);
+
+            for (; i + 4u <= count; i += 4u) {
+                const auto* p = points + i;
+                const auto px = _mm256_setr_pd(p[0].x(), p[1].x(), p[2].x(), p[3].x());
+                const auto py = _mm256_setr_pd(p[0].y(), p[1].y(), p[2].y(), p[3].y());
+                const auto pz = _mm256_setr_pd(p[0].z(), p[1].z(), p[2].z(), p[3].z());
+
+                auto dist = _mm256_add_pd(_mm256_setzero_pd(), _mm256_mul_pd(px, nx));
+                dist = _mm256_add_pd(dist, _mm256_mul_pd(py, ny));
+                dist = _mm256_add_pd(dist, _mm256_mul_pd(pz, nz));
+                dist = _mm256_sub_pd(dist, d);
+
+                result.above += countBits(_mm256_movemask_pd(_mm256_cmp_pd(dist, pe, _CMP_GT_OQ)));
+                result.below += countBits(_mm256_movemask_pd(_mm256_cmp_pd(dist, me, _CMP_LT_OQ)));
+            }
+#elif defined(TB_POINTSTATUS_SSE2)
+            const auto nx = _mm_set1_pd(plane.normal.x());
+            const auto ny = _mm_set1_pd(plane.normal.y());
+            const auto nz = _mm_set1_pd(plane.normal.z());
+            const auto d = _mm_set1_pd(plane.distance);
+            const auto pe = _mm_set1_pd(epsilon);
+            const auto me = _mm_set1_pd(-epsilon);
+
+            for (; i + 2u <= count; i += 2u) {
+                const auto* p = points + i;
+                const auto px = _mm_setr_pd(p[0].x(), p[1].x());
+                const auto py = _mm_setr_pd(p[0].y(), p[1].y());
+                const auto pz = _mm_setr_pd(p[0].z(), p[1].z());
+
+                auto dist = _mm_add_pd(_mm_setzero_pd(), _mm_mul_pd(px, nx));
+                dist = _mm_add_pd(dist, _mm_mul_pd(py, ny));
+                dist = _mm_add_pd(dist, _mm_mul_pd(pz, nz));
+                dist = _mm_sub_pd(dist, d);
+
+                result.above += countBits(_mm_movemask_pd(_mm_cmpgt_pd(dist, pe)));
+                result.below += countBits(_mm_movemask_pd(_mm_cmplt_pd(dist, me)));
+            }
+#endif
+            // the points processed by the vectorized loop that are neither above nor below are inside
+            result.inside = i - result.above - result.below;
+
+            // scalar fallback and remainder
+            const auto remainder = countPointStatus<double>(plane, points + i, count - i, epsilon);
+            result.above += remainder.above;
+            result.below += remainder.below;
+            result.inside += remainder.inside;
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TrenchBroom_PlanePointStatus_h
+#define TrenchBroom_PlanePointStatus_h
+
+#include "Macros.h"
+
+#include <vecmath/forward.h>
+#include <vecmath/plane.h>
+#include <vecmath/vec.h>
+
+#include <cstddef>
+
+namespace TrenchBroom {
+    namespace Model {
+        struct PointStatusCounts {
+            std::size_t above = 0u;
+            std::size_t below = 0u;
+            std::size_t inside = 0u;
+        };
+
+        /**
+         * Classifies the given points against the given plane and counts how many of them are above, below and inside
+         * of it. The classification of every point is identical to the result of vm::plane::point_status.
+         *
+         * This overload processes several points at once using AVX or SSE2 instructions if the compiler targets them.
+         */
+        PointStatusCounts countPointStatus(const vm::plane<double,3>& plane, const vm::vec<double,3>* points, std::size_t count, double epsilon);
+
+        /**
+         * Scalar version for all other types.
+         */
+        template <typename T>
+        PointStatusCounts countPointStatus(const vm::plane<T,3>& plane, const vm::vec<T,3>* points, const std::size_t count, const T epsilon) {
+            PointStatusCounts result;
+            for (std::size_t i = 0u; i < count; ++i) {
+                switch (plane.point_status(points[i], epsilon)) {
+                    case vm::plane_status::above:
+                        ++result.above;
+                        break;
+                    case vm::plane_status::below:
+                        ++result.below;
+                        break;
+                    case vm::plane_status::inside:
+                        ++result.inside;
+                        break;
+                    switchDefault()
+                }
+            }
+            return result;
+        }
+    }
+}
+
+#endif
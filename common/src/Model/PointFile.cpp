@@ -19,14 +19,21 @@
 
 #include "PointFile.h"
 
+#include "IO/DiskIO.h"
+#include "IO/File.h"
+#include "IO/LineParser.h"
 #include "IO/Path.h"
+#include "IO/Reader.h"
 
 #include <vecmath/vec.h>
-#include <vecmath/vec_io.h>
 
 #include <cassert>
+#include <cmath>
 #include <fstream>
+#include <limits>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace TrenchBroom {
     namespace Model {
@@ -86,26 +93,42 @@ namespace TrenchBroom {
         void PointFile::load(const IO::Path& path) {
             static const float Threshold = vm::to_radians(15.0f);
 
-            std::fstream stream(path.asString().c_str(), std::ios::in);
-            assert(stream.is_open());
+            const auto file = IO::Disk::openFile(path);
+            const auto buffer = file->reader().buffer();
+            auto text = std::string_view(buffer.begin(), static_cast<size_t>(buffer.end() - buffer.begin()));
+
+            const auto lines = IO::nextLines(text, std::numeric_limits<size_t>::max());
+            const auto parsedPoints = IO::parseLines(lines, [](const std::string_view line) -> std::optional<vm::vec3f> {
+                auto parser = IO::LineParser(line);
+                const auto x = parser.parseFloat();
+                const auto y = parser.parseFloat();
+                const auto z = parser.parseFloat();
+                if (!x || !y || !z) {
+                    return std::nullopt;
+                }
+                return vm::vec3f(*x, *y, *z);
+            });
+
+            // skip empty or malformed lines
+            std::vector<vm::vec3f> trace;
+            trace.reserve(parsedPoints.size());
+            for (const auto& point : parsedPoints) {
+                if (point) {
+                    trace.push_back(*point);
+                }
+            }
 
+            // only keep the points where the trace changes its direction
             std::vector<vm::vec3f> points;
+            if (!trace.empty()) {
+                points.push_back(trace.front());
 
-            if (!stream.eof()) {
-                std::string line;
-                std::getline(stream, line);
-                points.push_back(vm::parse<float, 3>(line));
-                vm::vec3f lastPoint = points.back();
-
-                if (!stream.eof()) {
-                    std::getline(stream, line);
-                    vm::vec3f curPoint = vm::parse<float, 3>(line);
-                    vm::vec3f refDir = normalize(curPoint - lastPoint);
+                if (trace.size() > 1u) {
+                    vm::vec3f refDir = normalize(trace[1] - trace[0]);
 
-                    while (!stream.eof()) {
-                        lastPoint = curPoint;
-                        std::getline(stream, line);
-                        curPoint = vm::parse<float, 3>(line);
+                    for (size_t i = 2u; i < trace.size(); ++i) {
+                        const vm::vec3f& lastPoint = trace[i - 1u];
+                        const vm::vec3f& curPoint = trace[i];
 
                         const vm::vec3f dir = normalize(curPoint - lastPoint);
                         if (std::acos(dot(dir, refDir)) > Threshold) {
@@ -114,7 +137,7 @@ namespace TrenchBroom {
                         }
                     }
 
-                    points.push_back(curPoint);
+                    points.push_back(trace.back());
                 }
             }
 
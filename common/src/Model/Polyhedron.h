@@ -31,6 +31,7 @@
 #include <vecmath/bbox.h>
 #include <vecmath/util.h>
 
+#include <cstddef>
 #include <initializer_list>
 #include <limits>
 #include <vector>
@@ -77,6 +78,11 @@ namespace TrenchBroom {
              */
             vm::vec<T,3> m_position;
 
+            /**
+             * The index of this vertex's position in the position mirror of its polyhedron.
+             */
+            std::size_t m_positionIndex;
+
             /**
              * A half edge that originates at this vertex.
              */
@@ -98,18 +104,19 @@ namespace TrenchBroom {
              * @param position the position of the new vertex
              */
             explicit Polyhedron_Vertex(const vm::vec<T,3>& position);
-        public:
-            /**
-             * Returns the position of this vertex.
-             */
-            const vm::vec<T,3>& position() const;
 
             /**
-             * Sets the position of this vertex.
+             * Sets the position of this vertex. Only the containing polyhedron may move a vertex because it must
+             * update its position mirror, see Polyhedron::setVertexPosition.
              *
              * @param position the position to set
              */
             void setPosition(const vm::vec<T,3>& position);
+        public:
+            /**
+             * Returns the position of this vertex.
+             */
+            const vm::vec<T,3>& position() const;
 
             /**
              * Returns the leaving half edge assigned to this vertex.
@@ -1094,6 +1101,18 @@ namespace TrenchBroom {
              */
             VertexList m_vertices;
 
+            /**
+             * The positions of the vertices of this polyhedron, stored contiguously so that they can be classified
+             * against a plane in one pass. The order does not match the order of m_vertices; every vertex knows the
+             * index of its position.
+             */
+            std::vector<vm::vec<T,3>> m_positions;
+
+            /**
+             * The vertices whose positions are stored in m_positions, at the same indices.
+             */
+            std::vector<Vertex*> m_positionVertices;
+
             /**
              * The edges of this polyhedron, stored in a circular list that owns them.
              */
@@ -1160,6 +1179,8 @@ namespace TrenchBroom {
             friend void swap(Polyhedron<T,FP,VP>& first, Polyhedron<T,FP,VP>& second) {
                 using std::swap;
                 swap(first.m_vertices, second.m_vertices);
+                swap(first.m_positions, second.m_positions);
+                swap(first.m_positionVertices, second.m_positionVertices);
                 swap(first.m_edges, second.m_edges);
                 swap(first.m_faces, second.m_faces);
                 swap(first.m_bounds, second.m_bounds);
@@ -1515,6 +1536,41 @@ namespace TrenchBroom {
              * @return the given valid edge, or its first successor that was not deleted by this function
              */
             Edge* mergeNeighbours(HalfEdge* borderFirst, Edge* validEdge, Callback& callback);
+        private: // vertex management, keeps the position mirror up to date
+            /**
+             * Appends the given vertex to the vertices of this polyhedron, which takes ownership of it.
+             *
+             * @param vertex the vertex to add, must not be null
+             */
+            void addVertex(Vertex* vertex);
+
+            /**
+             * Removes the given vertex from this polyhedron and deletes it.
+             *
+             * @param vertex the vertex to remove, must belong to this polyhedron
+             */
+            void removeVertex(Vertex* vertex);
+
+            /**
+             * Moves the given vertex to the given position.
+             *
+             * @param vertex the vertex to move, must belong to this polyhedron
+             * @param position the new position
+             */
+            void setVertexPosition(Vertex* vertex, const vm::vec<T,3>& position);
+
+            /**
+             * Removes the position of the given vertex from the position mirror. The position of the last vertex in
+             * the mirror takes its place.
+             *
+             * @param vertex the vertex whose position should be removed, must belong to this polyhedron
+             */
+            void removeVertexPosition(Vertex* vertex);
+
+            /**
+             * Rebuilds the position mirror from the vertices of this polyhedron.
+             */
+            void rebuildVertexPositions();
 
             /* ====================== Implementation in Polyhedron_ConvexHull.h ====================== */
         public: // Convex hull; adding and removing points
@@ -2188,6 +2244,7 @@ namespace TrenchBroom {
             bool checkNoDegenerateFaces() const;
             bool checkVertexLeavingEdges() const;
             bool checkEdges() const;
+            bool checkVertexPositions() const;
             bool checkEdgeLengths(const T minLength = MinEdgeLength) const;
             bool checkLeavingEdges(const Vertex* v) const;
         };
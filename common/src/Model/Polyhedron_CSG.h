@@ -45,6 +45,11 @@ namespace TrenchBroom {
 
         template <typename T, typename FP, typename VP>
         std::vector<Polyhedron<T,FP,VP>> Polyhedron<T,FP,VP>::subtract(const Polyhedron& subtrahend, const Callback& callback) const {
+            if (!bounds().intersects(subtrahend.bounds())) {
+                // disjoint, no need to clip the subtrahend
+                return { *this };
+            }
+
             Subtract subtract(*this, subtrahend, callback);
             return subtract.result();
         }
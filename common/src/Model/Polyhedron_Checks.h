@@ -43,6 +43,8 @@ namespace TrenchBroom {
                 return false;
             if (!checkEdges())
                 return false;
+            if (!checkVertexPositions())
+                return false;
             /* This check leads to false positive with almost coplanar faces.
              if (polyhedron() && !checkNoCoplanarFaces())
              return false;
@@ -303,5 +305,24 @@ namespace TrenchBroom {
 
             return true;
         }
+
+        template <typename T, typename FP, typename VP>
+        bool Polyhedron<T,FP,VP>::checkVertexPositions() const {
+            if (m_positions.size() != m_vertices.size() || m_positionVertices.size() != m_vertices.size()) {
+                return false;
+            }
+
+            for (const Vertex* vertex : m_vertices) {
+                const auto index = vertex->m_positionIndex;
+                if (index >= m_positions.size() || m_positionVertices[index] != vertex) {
+                    return false;
+                }
+                if (m_positions[index] != vertex->position()) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
     }
 }
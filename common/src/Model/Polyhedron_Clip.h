@@ -25,6 +25,7 @@
 #include "Exceptions.h"
 
 #include "Polyhedron.h"
+#include "Model/PlanePointStatus.h"
 
 #include <vecmath/plane.h>
 #include <vecmath/scalar.h>
@@ -105,26 +106,9 @@ namespace TrenchBroom {
 
         template <typename T, typename FP, typename VP>
         typename Polyhedron<T,FP,VP>::ClipResult Polyhedron<T,FP,VP>::checkIntersects(const vm::plane<T,3>& plane) const {
-            std::size_t above = 0u;
-            std::size_t below = 0u;
-            std::size_t inside = 0u;
-
-
-            for (const Vertex* currentVertex : m_vertices) {
-                const vm::plane_status status = plane.point_status(currentVertex->position());
-                switch (status) {
-                    case vm::plane_status::above:
-                        ++above;
-                        break;
-                    case vm::plane_status::below:
-                        ++below;
-                        break;
-                    case vm::plane_status::inside:
-                        ++inside;
-                        break;
-                        switchDefault()
-                }
-            }
+            // The position mirror stores the vertex positions contiguously so that they can be classified in one pass.
+            assert(m_positions.size() == m_vertices.size());
+            const auto [above, below, inside] = countPointStatus(plane, m_positions.data(), m_positions.size(), vm::constants<T>::point_status_epsilon());
 
             assert(above + below + inside == m_vertices.size());
 
@@ -275,7 +259,7 @@ namespace TrenchBroom {
                     Vertex* newVertex = currentBoundaryEdge->origin();
                     assert(plane.point_status(newVertex->position()) == vm::plane_status::inside);
 
-                    m_vertices.push_back(newVertex);
+                    addVertex(newVertex);
                     callback.vertexWasCreated(newVertex);
 
                     // The newly inserted vertex will be reexamined in the next loop iteration as it is now contained within the plane.
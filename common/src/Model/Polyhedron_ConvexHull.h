@@ -115,7 +115,7 @@ namespace TrenchBroom {
         typename Polyhedron<T,FP,VP>::Vertex* Polyhedron<T,FP,VP>::addFirstPoint(const vm::vec<T,3>& position, Callback& callback) {
             assert(empty());
             Vertex* newVertex = new Vertex(position);
-            m_vertices.push_back(newVertex);
+            addVertex(newVertex);
             callback.vertexWasCreated(newVertex);
             return newVertex;
         }
@@ -127,7 +127,7 @@ namespace TrenchBroom {
             Vertex* onlyVertex = *std::begin(m_vertices);
             if (position != onlyVertex->position()) {
                 Vertex* newVertex = new Vertex(position);
-                m_vertices.push_back(newVertex);
+                addVertex(newVertex);
                 callback.vertexWasCreated(newVertex);
 
                 HalfEdge* halfEdge1 = new HalfEdge(onlyVertex);
@@ -167,12 +167,12 @@ namespace TrenchBroom {
             }
 
             if (vm::segment<T,3>(position, v2->position()).contains(v1->position(), vm::constants<T>::almost_zero())) {
-                v1->setPosition(position);
+                setVertexPosition(v1, position);
                 return v1;
             }
 
             assert((vm::segment<T,3>(position, v1->position()).contains(v2->position(), vm::constants<T>::almost_zero())));
-            v2->setPosition(position);
+            setVertexPosition(v2, position);
             return v2;
         }
 
@@ -208,7 +208,7 @@ namespace TrenchBroom {
             Edge* e2 = new Edge(h2);
             Edge* e3 = new Edge(h3);
 
-            m_vertices.push_back(v3);
+            addVertex(v3);
             m_edges.push_back(e2);
             m_edges.push_back(e3);
             m_faces.push_back(face);
@@ -313,13 +313,13 @@ namespace TrenchBroom {
                 if (curEdge != visibleEdges.front()) {
                     Vertex* vertex = curEdge->origin();
                     callback.vertexWillBeDeleted(vertex);
-                    m_vertices.remove(vertex);
+                    removeVertex(vertex);
                 }
             }
 
             m_edges.push_back(e1);
             m_edges.push_back(e2);
-            m_vertices.push_back(newVertex);
+            addVertex(newVertex);
             callback.vertexWasCreated(newVertex);
 
             return newVertex;
@@ -337,7 +337,7 @@ namespace TrenchBroom {
                 HalfEdge* h = new HalfEdge(v);
                 Edge* e = new Edge(h);
 
-                m_vertices.push_back(v);
+                addVertex(v);
                 callback.vertexWasCreated(v);
 
                 boundary.push_back(h);
@@ -796,6 +796,7 @@ namespace TrenchBroom {
                     // We expect that the vertices on the seam have had a remaining edge
                     // set as their leaving edge before the call to this function.
                     callback.vertexWillBeDeleted(origin);
+                    removeVertexPosition(origin);
                     verticesToDelete.splice_back(m_vertices, VertexList::iter(origin), std::next(VertexList::iter(origin)), 1u);
                 }
                 current = current->next();
@@ -955,7 +956,7 @@ namespace TrenchBroom {
             assert(first->face() != last->face());
             m_edges.push_back(new Edge(first, last));
 
-            m_vertices.push_back(top);
+            addVertex(top);
             callback.vertexWasCreated(top);
 
             return top;
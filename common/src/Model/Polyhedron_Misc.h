@@ -140,14 +140,14 @@ namespace TrenchBroom {
             Vertex* v7 = new Vertex(p7);
             Vertex* v8 = new Vertex(p8);
 
-            m_vertices.push_back(v1);
-            m_vertices.push_back(v2);
-            m_vertices.push_back(v3);
-            m_vertices.push_back(v4);
-            m_vertices.push_back(v5);
-            m_vertices.push_back(v6);
-            m_vertices.push_back(v7);
-            m_vertices.push_back(v8);
+            addVertex(v1);
+            addVertex(v2);
+            addVertex(v3);
+            addVertex(v4);
+            addVertex(v5);
+            addVertex(v6);
+            addVertex(v7);
+            addVertex(v8);
 
             // Front face
             HalfEdge* f1h1 = new HalfEdge(v1);
@@ -248,6 +248,8 @@ namespace TrenchBroom {
         template <typename T, typename FP, typename VP>
         Polyhedron<T,FP,VP>::Polyhedron(Polyhedron<T,FP,VP>&& other) noexcept :
             m_vertices(std::move(other.m_vertices)),
+            m_positions(std::move(other.m_positions)),
+            m_positionVertices(std::move(other.m_positionVertices)),
             m_edges(std::move(other.m_edges)),
             m_faces(std::move(other.m_faces)),
             m_bounds(std::move(other.m_bounds)) {}
@@ -397,6 +399,7 @@ namespace TrenchBroom {
                 swap(m_vertices, m_destination.m_vertices);
                 swap(m_edges, m_destination.m_edges);
                 swap(m_faces, m_destination.m_faces);
+                m_destination.rebuildVertexPositions();
                 m_destination.updateBounds();
             }
         };
@@ -529,6 +532,8 @@ namespace TrenchBroom {
             m_faces.clear();
             m_edges.clear();
             m_vertices.clear();
+            m_positions.clear();
+            m_positionVertices.clear();
             updateBounds();
         }
 
@@ -803,7 +808,7 @@ namespace TrenchBroom {
             }
 
             callback.vertexWillBeDeleted(secondVertex);
-            m_vertices.remove(secondVertex);
+            removeVertex(secondVertex);
 
             auto* result = edge->next();
             m_edges.remove(edge);
@@ -933,7 +938,7 @@ namespace TrenchBroom {
                 // don't delete the origin of the first border edge!
                 if (curEdge != borderFirst) {
                     callback.vertexWillBeDeleted(origin);
-                    m_vertices.remove(origin);
+                    removeVertex(origin);
                 }
 
                 curEdge = next;
@@ -944,6 +949,57 @@ namespace TrenchBroom {
 
             return validEdge;
         }
+
+        template <typename T, typename FP, typename VP>
+        void Polyhedron<T,FP,VP>::addVertex(Vertex* vertex) {
+            assert(vertex != nullptr);
+            m_vertices.push_back(vertex);
+            vertex->m_positionIndex = m_positions.size();
+            m_positions.push_back(vertex->position());
+            m_positionVertices.push_back(vertex);
+        }
+
+        template <typename T, typename FP, typename VP>
+        void Polyhedron<T,FP,VP>::removeVertex(Vertex* vertex) {
+            removeVertexPosition(vertex);
+            m_vertices.remove(vertex);
+        }
+
+        template <typename T, typename FP, typename VP>
+        void Polyhedron<T,FP,VP>::setVertexPosition(Vertex* vertex, const vm::vec<T,3>& position) {
+            assert(m_positionVertices[vertex->m_positionIndex] == vertex);
+            vertex->setPosition(position);
+            m_positions[vertex->m_positionIndex] = position;
+        }
+
+        template <typename T, typename FP, typename VP>
+        void Polyhedron<T,FP,VP>::removeVertexPosition(Vertex* vertex) {
+            const auto index = vertex->m_positionIndex;
+            assert(index < m_positionVertices.size());
+            assert(m_positionVertices[index] == vertex);
+
+            Vertex* last = m_positionVertices.back();
+            m_positions[index] = m_positions.back();
+            m_positionVertices[index] = last;
+            last->m_positionIndex = index;
+
+            m_positions.pop_back();
+            m_positionVertices.pop_back();
+        }
+
+        template <typename T, typename FP, typename VP>
+        void Polyhedron<T,FP,VP>::rebuildVertexPositions() {
+            m_positions.clear();
+            m_positionVertices.clear();
+            m_positions.reserve(m_vertices.size());
+            m_positionVertices.reserve(m_vertices.size());
+
+            for (Vertex* vertex : m_vertices) {
+                vertex->m_positionIndex = m_positions.size();
+                m_positions.push_back(vertex->position());
+                m_positionVertices.push_back(vertex);
+            }
+        }
     }
 }
 
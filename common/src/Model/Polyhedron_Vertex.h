@@ -39,6 +39,7 @@ namespace TrenchBroom {
         template <typename T, typename FP, typename VP>
         Polyhedron_Vertex<T,FP,VP>::Polyhedron_Vertex(const vm::vec<T,3>& position) :
             m_position(position),
+            m_positionIndex(0u),
             m_leaving(nullptr),
 #ifdef _MSC_VER
         // MSVC throws a warning because we're passing this to the FaceLink constructor, but it's okay because we just store the pointer there.
@@ -20,10 +20,13 @@
 #include "PortalFile.h"
 
 #include "Exceptions.h"
+#include "IO/DiskIO.h"
+#include "IO/File.h"
+#include "IO/LineParser.h"
 #include "IO/Path.h"
+#include "IO/Reader.h"
 
 #include <kdl/string_format.h>
-#include <kdl/string_utils.h>
 
 #include <vecmath/forward.h>
 #include <vecmath/polygon.h>
@@ -31,6 +34,8 @@
 
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace TrenchBroom {
     namespace Model {
@@ -50,67 +55,88 @@ namespace TrenchBroom {
             return m_portals;
         }
 
-        void PortalFile::load(const IO::Path& path) {
-            std::fstream stream(path.asString(), std::ios::in);
-            if (!stream.good()) {
-                throw FileFormatException("Couldn't open file");
+        /**
+         * Reads the next header line and parses it as an integer.
+         */
+        static long parseHeaderInteger(std::string_view& text) {
+            const auto line = IO::nextLine(text);
+            if (!line) {
+                throw FileFormatException("Error reading header");
+            }
+
+            auto parser = IO::LineParser(*line);
+            const auto value = parser.parseInteger();
+            if (!value || *value < 0) {
+                throw FileFormatException("Error reading header");
+            }
+            return *value;
+        }
+
+        /**
+         * Parses a portal of the form "numPoints leaf1 leaf2 (x y z ) (x y z ) ...".
+         */
+        static vm::polygon3f parsePortal(const std::string_view line) {
+            // the shortest possible point is "(0 0 0)", so the line cannot hold more points than this allows
+            constexpr size_t MinPointLength = 7u;
+
+            auto parser = IO::LineParser(line);
+
+            const auto numPoints = parser.parseInteger();
+            if (!numPoints || *numPoints < 0 || static_cast<size_t>(*numPoints) > line.size() / MinPointLength ||
+                !parser.parseInteger() || !parser.parseInteger()) {
+                throw FileFormatException("Error reading portal");
             }
 
-            std::string line;
-            int numPortals;
+            std::vector<vm::vec3f> verts;
+            verts.reserve(static_cast<size_t>(*numPoints));
+            for (long i = 0; i < *numPoints; ++i) {
+                parser.consume('(');
+                const auto x = parser.parseFloat();
+                const auto y = parser.parseFloat();
+                const auto z = parser.parseFloat();
+                if (!x || !y || !z) {
+                    throw FileFormatException("Error reading portal");
+                }
+                parser.consume(')');
+
+                verts.emplace_back(*x, *y, *z);
+            }
+
+            return vm::polygon3f(std::move(verts));
+        }
+
+        void PortalFile::load(const IO::Path& path) {
+            const auto file = IO::Disk::openFile(path);
+            const auto buffer = file->reader().buffer();
+            auto text = std::string_view(buffer.begin(), static_cast<size_t>(buffer.end() - buffer.begin()));
 
             // read header
-            std::getline(stream, line);
-            const std::string formatCode = kdl::str_trim(line); // trim off any trailing \r
+            const auto formatLine = IO::nextLine(text);
+            const auto formatCode = formatLine ? kdl::str_trim(*formatLine) : std::string(); // trim off any trailing whitespace
 
+            long numPortals;
             if (formatCode == "PRT1") {
-                std::getline(stream, line); // number of leafs (ignored)
-                std::getline(stream, line); // number of portals
-                numPortals = std::stoi(line);
+                parseHeaderInteger(text); // number of leafs (ignored)
+                numPortals = parseHeaderInteger(text);
             } else if (formatCode == "PRT2") {
-                std::getline(stream, line); // number of leafs (ignored)
-                std::getline(stream, line); // number of clusters (ignored)
-                std::getline(stream, line); // number of portals
-                numPortals = std::stoi(line);
+                parseHeaderInteger(text); // number of leafs (ignored)
+                parseHeaderInteger(text); // number of clusters (ignored)
+                numPortals = parseHeaderInteger(text);
             } else if (formatCode == "PRT1-AM") {
-                std::getline(stream, line); // number of clusters (ignored)
-                std::getline(stream, line); // number of portals
-                numPortals = std::stoi(line);
-                std::getline(stream, line); // number of leafs (ignored)
+                parseHeaderInteger(text); // number of clusters (ignored)
+                numPortals = parseHeaderInteger(text);
+                parseHeaderInteger(text); // number of leafs (ignored)
             } else {
                 throw FileFormatException("Unknown portal format: " + formatCode);
             }
 
-            if (!stream.good()) {
-                throw FileFormatException("Error reading header");
+            // read portals, any lines following them contain leaf or cluster information and are ignored
+            const auto lines = IO::nextLines(text, static_cast<size_t>(numPortals));
+            if (lines.size() < static_cast<size_t>(numPortals)) {
+                throw FileFormatException("Error reading portal");
             }
 
-            // read portals
-            for (int i = 0; i < numPortals; ++i) {
-                std::getline(stream, line);
-                const auto components = kdl::str_split(line, "() \n\t\r");
-
-                if (!stream.good() || components.size() < 3) {
-                    throw FileFormatException("Error reading portal");
-                }
-
-                std::vector<vm::vec3f> verts;
-                size_t ptr = 3;
-                const int numPoints = std::stoi(components.at(0));
-                for (int j = 0; j < numPoints; ++j) {
-                    if (ptr + 2 >= components.size()) {
-                        throw FileFormatException("Error reading portal");
-                    }
-
-                    const vm::vec3f vert(std::stof(components.at(ptr)),
-                                     std::stof(components.at(ptr+1)),
-                                     std::stof(components.at(ptr+2)));
-                    verts.push_back(vert);
-                    ptr += 3;
-                }
-
-                m_portals.push_back(vm::polygon3f(verts));
-            }
+            m_portals = IO::parseLines(lines, parsePortal);
         }
     }
 }
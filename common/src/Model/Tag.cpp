@@ -20,6 +20,7 @@
 #include "Tag.h"
 
 #include "IO/Path.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/TagManager.h"
 
 #include <cassert>
@@ -136,6 +137,7 @@ namespace TrenchBroom {
                 m_tags.emplace(tag);
 
                 updateAttributeMask();
+                EditorStateGeneration::increment();
                 return true;
             }
         }
@@ -151,6 +153,7 @@ namespace TrenchBroom {
             assert(!hasTag(tag));
 
             updateAttributeMask();
+            EditorStateGeneration::increment();
             return true;
         }
 
@@ -164,7 +167,16 @@ namespace TrenchBroom {
             updateAttributeMask();
         }
 
+        void Taggable::updateTags(TagManager& tagManager, const TagDependency::Type dependencies) {
+            tagManager.updateTags(*this, dependencies);
+            updateAttributeMask();
+        }
+
         void Taggable::clearTags() {
+            if (m_tagMask != 0) {
+                EditorStateGeneration::increment();
+            }
+
             m_tagMask = 0;
             m_tags.clear();
             updateAttributeMask();
@@ -196,6 +208,10 @@ namespace TrenchBroom {
 
         TagMatcher::~TagMatcher() = default;
 
+        TagDependency::Type TagMatcher::dependencies() const {
+            return TagDependency::All;
+        }
+
         void TagMatcher::enable(TagMatcherCallback& /* callback */, MapFacade& /* facade */) const {}
         void TagMatcher::disable(TagMatcherCallback& /* callback */, MapFacade& /* facade */) const {}
 
@@ -231,6 +247,10 @@ namespace TrenchBroom {
             return m_matcher->matches(taggable) ;
         }
 
+        TagDependency::Type SmartTag::dependencies() const {
+            return m_matcher->dependencies();
+        }
+
         void SmartTag::update(Taggable& taggable) const {
             if (matches(taggable)) {
                 taggable.addTag(*this);
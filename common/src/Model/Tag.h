@@ -237,6 +237,15 @@ namespace TrenchBroom {
              */
             virtual void updateTags(TagManager& tagManager);
 
+            /**
+             * Updates only those tags of this object whose matchers depend on any of the given properties. Tags whose
+             * matchers only depend on other properties are left unchanged.
+             *
+             * @param tagManager the tag manager
+             * @param dependencies the properties that have changed
+             */
+            void updateTags(TagManager& tagManager, TagDependency::Type dependencies);
+
             /**
              * Removes all tags from this object.
              */
@@ -288,6 +297,15 @@ namespace TrenchBroom {
         public:
             virtual ~TagMatcher();
         public:
+            /**
+             * Returns a bit mask of the properties of a taggable that this matcher inspects. If none of these
+             * properties change, then the result of this matcher does not change either and the tag need not be
+             * updated.
+             *
+             * The default implementation returns TagDependency::All.
+             */
+            virtual TagDependency::Type dependencies() const;
+
             /**
              * Evaluates this tag matcher against the given taggable by calling Taggable::evaluateTagMatcher.
              *
@@ -362,6 +380,11 @@ namespace TrenchBroom {
              */
             bool matches(const Taggable& taggable) const;
 
+            /**
+             * Returns the properties of a taggable that this smart tag's matcher depends on.
+             */
+            TagDependency::Type dependencies() const;
+
             /**
              * Updates the given tag depending on whether or not the matcher matches against it.
              *
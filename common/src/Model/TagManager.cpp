@@ -98,6 +98,14 @@ namespace TrenchBroom {
             }
         }
 
+        void TagManager::updateTags(Taggable& taggable, const TagDependency::Type dependencies) const {
+            for (const auto& tag : m_smartTags) {
+                if ((tag.dependencies() & dependencies) != 0) {
+                    tag.update(taggable);
+                }
+            }
+        }
+
         size_t TagManager::freeTagIndex() {
             static const size_t Bits = (sizeof(TagType::Type) * 8);
             const auto index = m_smartTags.size();
@@ -105,6 +105,15 @@ namespace TrenchBroom {
              * @param taggable the object to update
              */
             void updateTags(Taggable& taggable) const;
+
+            /**
+             * Update those smart tags of the given taggable object whose matchers depend on any of the given
+             * properties.
+             *
+             * @param taggable the object to update
+             * @param dependencies the properties of the object that have changed
+             */
+            void updateTags(Taggable& taggable, TagDependency::Type dependencies) const;
         private:
             size_t freeTagIndex();
         };
@@ -36,6 +36,7 @@
 #include <kdl/string_compare.h>
 #include <kdl/vector_utils.h>
 
+#include <mutex>
 #include <vector>
 
 namespace TrenchBroom {
@@ -70,6 +71,10 @@ namespace TrenchBroom {
             return std::make_unique<TextureNameTagMatcher>(m_pattern);
         }
 
+        TagDependency::Type TextureNameTagMatcher::dependencies() const {
+            return TagDependency::FaceTexture;
+        }
+
         bool TextureNameTagMatcher::matches(const Taggable& taggable) const {
             BrushFaceMatchVisitor visitor([this](const BrushFace& face) {
                 return matchesTextureName(face.textureName());
@@ -118,7 +123,23 @@ namespace TrenchBroom {
             return true;
         }
 
-        bool TextureNameTagMatcher::matchesTextureName(std::string_view textureName) const {
+        bool TextureNameTagMatcher::matchesTextureName(const std::string& textureName) const {
+            {
+                std::shared_lock<std::shared_mutex> lock(m_cacheMutex);
+                const auto it = m_cache.find(textureName);
+                if (it != std::end(m_cache)) {
+                    return it->second;
+                }
+            }
+
+            const auto result = doMatchesTextureName(textureName);
+
+            std::unique_lock<std::shared_mutex> lock(m_cacheMutex);
+            m_cache.emplace(textureName, result);
+            return result;
+        }
+
+        bool TextureNameTagMatcher::doMatchesTextureName(std::string_view textureName) const {
             const auto pos = textureName.find_last_of('/');
             if (pos != std::string::npos) {
                 textureName = textureName.substr(pos + 1);
@@ -134,6 +155,10 @@ namespace TrenchBroom {
             return std::make_unique<SurfaceParmTagMatcher>(m_parameter);
         }
 
+        TagDependency::Type SurfaceParmTagMatcher::dependencies() const {
+            return TagDependency::FaceTexture;
+        }
+
         bool SurfaceParmTagMatcher::matches(const Taggable& taggable) const {
             BrushFaceMatchVisitor visitor([this](const BrushFace& face) {
                 const auto* texture = face.texture();
@@ -157,6 +182,10 @@ namespace TrenchBroom {
         m_unsetFlags(std::move(unsetFlags)),
         m_getFlagNames(std::move(getFlagNames)) {}
 
+        TagDependency::Type FlagsTagMatcher::dependencies() const {
+            return TagDependency::FaceFlags;
+        }
+
         bool FlagsTagMatcher::matches(const Taggable& taggable) const {
             BrushFaceMatchVisitor visitor([this](const BrushFace& face) {
                 return (m_getFlags(face) & m_flags) != 0;
@@ -255,6 +284,10 @@ namespace TrenchBroom {
             return std::make_unique<EntityClassNameTagMatcher>(m_pattern, m_texture);
         }
 
+        TagDependency::Type EntityClassNameTagMatcher::dependencies() const {
+            return TagDependency::Entity;
+        }
+
         bool EntityClassNameTagMatcher::matches(const Taggable& taggable) const {
             BrushMatchVisitor visitor([this](const Brush& brush) {
                 const auto* entity = brush.entity();
@@ -25,8 +25,10 @@
 
 #include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace TrenchBroom {
@@ -71,15 +73,24 @@ namespace TrenchBroom {
         class TextureNameTagMatcher : public TagMatcher {
         private:
             std::string m_pattern;
+
+            /**
+             * Since the result of this matcher only depends on the texture name, the result of matching the pattern
+             * against each texture name is cached.
+             */
+            mutable std::shared_mutex m_cacheMutex;
+            mutable std::unordered_map<std::string, bool> m_cache;
         public:
             explicit TextureNameTagMatcher(const std::string& pattern);
             std::unique_ptr<TagMatcher> clone() const override;
         public:
+            TagDependency::Type dependencies() const override;
             bool matches(const Taggable& taggable) const override;
             void enable(TagMatcherCallback& callback, MapFacade& facade) const override;
             bool canEnable() const override;
         private:
-            bool matchesTextureName(std::string_view textureName) const;
+            bool matchesTextureName(const std::string& textureName) const;
+            bool doMatchesTextureName(std::string_view textureName) const;
         };
 
         class SurfaceParmTagMatcher : public TagMatcher {
@@ -88,6 +99,8 @@ namespace TrenchBroom {
         public:
             explicit SurfaceParmTagMatcher(const std::string& parameter);
             std::unique_ptr<TagMatcher> clone() const override;
+        public:
+            TagDependency::Type dependencies() const override;
         private:
             bool matches(const Taggable& taggable) const override;
         };
@@ -105,6 +118,8 @@ namespace TrenchBroom {
             GetFlagNames m_getFlagNames;
         protected:
             FlagsTagMatcher(int flags, GetFlags getFlags, SetFlags setFlags, SetFlags unsetFlags, GetFlagNames getFlagNames);
+        public:
+            TagDependency::Type dependencies() const override;
         private:
             bool matches(const Taggable& taggable) const override;
             void enable(TagMatcherCallback& callback, MapFacade& facade) const override;
@@ -135,6 +150,8 @@ namespace TrenchBroom {
         public:
             EntityClassNameTagMatcher(const std::string& pattern, const std::string& texture);
             std::unique_ptr<TagMatcher> clone() const override;
+        public:
+            TagDependency::Type dependencies() const override;
         private:
             bool matches(const Taggable& taggable) const override;
         public:
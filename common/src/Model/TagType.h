@@ -30,6 +30,22 @@ namespace TrenchBroom {
             constexpr Type NoType  =  0u;
             constexpr Type AnyType = ~NoType;
         }
+
+        /**
+         * The properties of a taggable object that a tag matcher can depend on.
+         */
+        namespace TagDependency {
+            using Type = unsigned int;
+
+            constexpr Type None         = 0u;
+            /** The texture name and the texture assigned to a face. */
+            constexpr Type FaceTexture  = 1u << 0;
+            /** The surface flags, content flags and surface value of a face. */
+            constexpr Type FaceFlags    = 1u << 1;
+            /** The properties of the entity that contains a brush. */
+            constexpr Type Entity       = 1u << 2;
+            constexpr Type All          = ~None;
+        }
     }
 }
 
@@ -24,6 +24,13 @@
 #include <vecmath/mat.h>
 #include <vecmath/mat_ext.h>
 
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TB_TEXCOORDS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace TrenchBroom {
     namespace Model {
         TexCoordSystemSnapshot::~TexCoordSystemSnapshot() = default;
@@ -76,6 +83,10 @@ namespace TrenchBroom {
             return doGetTexCoords(point, attribs);
         }
 
+        void TexCoordSystem::getTexCoords(const vm::vec3* points, const size_t count, const BrushFaceAttributes& attribs, vm::vec2f* result) const {
+            doGetTexCoords(points, count, attribs, result);
+        }
+
         void TexCoordSystem::setRotation(const vm::vec3& normal, const float oldAngle, const float newAngle) {
             doSetRotation(normal, oldAngle, newAngle);
         }
@@ -209,5 +220,87 @@ namespace TrenchBroom {
                          dot(point, safeScaleAxis(getYAxis(), scale.y())));
         }
 
+        static_assert(sizeof(vm::vec3) == 3u * sizeof(double), "vm::vec3 must be tightly packed");
+        static_assert(sizeof(vm::vec2f) == 2u * sizeof(float), "vm::vec2f must be tightly packed");
+
+        /*
+         * The vectorized loops process several points at a time, with one point per lane. Every lane performs exactly
+         * the same sequence of operations as the single point version, i.e., the dot products are accumulated in
+         * double precision starting from zero, the results are converted to float, and then the offset is added and
+         * the sum is divided by the texture size in single precision. Therefore the results are bitwise identical.
+         */
+        void TexCoordSystem::computeTexCoords(const vm::vec3* points, const size_t count, const BrushFaceAttributes& attribs, vm::vec2f* result) const {
+            const auto scale = attribs.scale();
+            const auto xAxis = safeScaleAxis(getXAxis(), scale.x());
+            const auto yAxis = safeScaleAxis(getYAxis(), scale.y());
+            const auto offset = attribs.offset();
+            const auto textureSize = attribs.textureSize();
+
+            size_t i = 0u;
+#if defined(__AVX__)
+            const auto xx = _mm256_set1_pd(xAxis.x()), xy = _mm256_set1_pd(xAxis.y()), xz = _mm256_set1_pd(xAxis.z());
+            const auto yx = _mm256_set1_pd(yAxis.x()), yy = _mm256_set1_pd(yAxis.y()), yz = _mm256_set1_pd(yAxis.z());
+            const auto off = _mm_setr_ps(offset.x(), offset.y(), offset.x(), offset.y());
+            const auto size = _mm_setr_ps(textureSize.x(), textureSize.y(), textureSize.x(), textureSize.y());
+
+            for (; i + 4u <= count; i += 4u) {
+                const auto* p = points + i;
+                const auto px = _mm256_setr_pd(p[0].x(), p[1].x(), p[2].x(), p[3].x());
+                const auto py = _mm256_setr_pd(p[0].y(), p[1].y(), p[2].y(), p[3].y());
+                const auto pz = _mm256_setr_pd(p[0].z(), p[1].z(), p[2].z(), p[3].z());
+
+                auto u = _mm256_add_pd(_mm256_setzero_pd(), _mm256_mul_pd(px, xx));
+                u = _mm256_add_pd(u, _mm256_mul_pd(py, xy));
+                u = _mm256_add_pd(u, _mm256_mul_pd(pz, xz));
+
+                auto v = _mm256_add_pd(_mm256_setzero_pd(), _mm256_mul_pd(px, yx));
+                v = _mm256_add_pd(v, _mm256_mul_pd(py, yy));
+                v = _mm256_add_pd(v, _mm256_mul_pd(pz, yz));
+
+                const auto uf = _mm256_cvtpd_ps(u);
+                const auto vf = _mm256_cvtpd_ps(v);
+                const auto uv01 = _mm_div_ps(_mm_add_ps(_mm_unpacklo_ps(uf, vf), off), size);
+                const auto uv23 = _mm_div_ps(_mm_add_ps(_mm_unpackhi_ps(uf, vf), off), size);
+
+                auto* r = reinterpret_cast<float*>(result + i);
+                _mm_storeu_ps(r, uv01);
+                _mm_storeu_ps(r + 4, uv23);
+            }
+#elif defined(TB_TEXCOORDS_SSE2)
+            const auto xx = _mm_set1_pd(xAxis.x()), xy = _mm_set1_pd(xAxis.y()), xz = _mm_set1_pd(xAxis.z());
+            const auto yx = _mm_set1_pd(yAxis.x()), yy = _mm_set1_pd(yAxis.y()), yz = _mm_set1_pd(yAxis.z());
+            const auto off = _mm_setr_ps(offset.x(), offset.y(), offset.x(), offset.y());
+            const auto size = _mm_setr_ps(textureSize.x(), textureSize.y(), textureSize.x(), textureSize.y());
+
+            for (; i + 2u <= count; i += 2u) {
+                const auto* p = points + i;
+                const auto px = _mm_setr_pd(p[0].x(), p[1].x());
+                const auto py = _mm_setr_pd(p[0].y(), p[1].y());
+                const auto pz = _mm_setr_pd(p[0].z(), p[1].z());
+
+                auto u = _mm_add_pd(_mm_setzero_pd(), _mm_mul_pd(px, xx));
+                u = _mm_add_pd(u, _mm_mul_pd(py, xy));
+                u = _mm_add_pd(u, _mm_mul_pd(pz, xz));
+
+                auto v = _mm_add_pd(_mm_setzero_pd(), _mm_mul_pd(px, yx));
+                v = _mm_add_pd(v, _mm_mul_pd(py, yy));
+                v = _mm_add_pd(v, _mm_mul_pd(pz, yz));
+
+                // the lower two lanes of uf and vf hold the converted values, the upper two lanes are zero
+                const auto uf = _mm_cvtpd_ps(u);
+                const auto vf = _mm_cvtpd_ps(v);
+                const auto uv01 = _mm_div_ps(_mm_add_ps(_mm_unpacklo_ps(uf, vf), off), size);
+
+                _mm_storeu_ps(reinterpret_cast<float*>(result + i), uv01);
+            }
+#endif
+
+            // scalar fallback and remainder
+            for (; i < count; ++i) {
+                const auto texCoords = vm::vec2f(dot(points[i], xAxis), dot(points[i], yAxis));
+                result[i] = (texCoords + offset) / textureSize;
+            }
+        }
+
     }
 }
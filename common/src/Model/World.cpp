@@ -26,9 +26,13 @@
 #include "Model/Brush.h"
 #include "Model/BrushFace.h"
 #include "Model/CollectNodesWithDescendantSelectionCountVisitor.h"
+#include "Model/EditorContext.h"
+#include "Model/Hit.h"
+#include "Model/HitFilter.h"
 #include "Model/IssueGenerator.h"
 #include "Model/IssueGeneratorRegistry.h"
 #include "Model/ModelFactoryImpl.h"
+#include "Model/PickResult.h"
 #include "Model/TagVisitor.h"
 
 #include <kdl/vector_utils.h>
@@ -171,6 +175,42 @@ namespace TrenchBroom {
             m_nodeTree->clearAndBuild(collect.nodes(), [](const auto* node){ return node->physicalBounds(); });
         }
 
+        std::vector<Node*> World::findNodesIntersecting(const vm::bbox3& bounds) const {
+            return m_nodeTree->findIntersectors(bounds);
+        }
+
+        std::vector<Node*> World::findNodesIntersecting(const std::vector<vm::plane3>& planes) const {
+            return m_nodeTree->findIntersectors(planes);
+        }
+
+        Hit World::pickClosest(const vm::ray3& ray, const EditorContext& editorContext, const HitFilter& filter) {
+            auto closestHit = Hit::NoHit;
+
+            // reused for every node to avoid allocating a new hit list per node
+            auto pickResult = PickResult();
+            m_nodeTree->findClosestIntersector(ray, [&](Node* node) {
+                if (!editorContext.pickable(node)) {
+                    return vm::nan<FloatType>();
+                }
+
+                pickResult.clear();
+                node->pick(ray, pickResult);
+
+                // the hits are sorted by distance
+                for (const auto& hit : pickResult.all()) {
+                    if (filter.matches(hit)) {
+                        if (!closestHit.isMatch() || hit.distance() < closestHit.distance()) {
+                            closestHit = hit;
+                        }
+                        return hit.distance();
+                    }
+                }
+                return vm::nan<FloatType>();
+            });
+
+            return closestHit;
+        }
+
         class World::InvalidateAllIssuesVisitor : public NodeVisitor {
         private:
             void doVisit(World* world) override   { invalidateIssues(world);  }
@@ -36,6 +36,9 @@ namespace TrenchBroom {
 
     namespace Model {
         class AttributableNodeIndex;
+        class EditorContext;
+        class Hit;
+        class HitFilter;
         class IssueGeneratorRegistry;
         class IssueQuickFix;
         class PickResult;
@@ -76,6 +79,26 @@ namespace TrenchBroom {
             void disableNodeTreeUpdates();
             void enableNodeTreeUpdates();
             void rebuildNodeTree();
+        public: // spatial queries
+            /**
+             * Returns every entity and brush whose physical bounds intersect the given bounds.
+             */
+            std::vector<Node*> findNodesIntersecting(const vm::bbox3& bounds) const;
+
+            /**
+             * Returns every entity and brush whose physical bounds may intersect the convex volume bounded by the given
+             * planes. The result may contain nodes near the edges of the volume which don't intersect it.
+             */
+            std::vector<Node*> findNodesIntersecting(const std::vector<vm::plane3>& planes) const;
+
+            /**
+             * Returns the closest hit of the given ray that matches the given filter, or Hit::NoHit if there is no such
+             * hit. Nodes which are not pickable in the given editor context are skipped.
+             *
+             * Unlike pick, this traverses the node tree front to back and skips every node whose bounds the ray enters
+             * behind the closest hit found so far, so prefer this if only the closest hit is needed.
+             */
+            Hit pickClosest(const vm::ray3& ray, const EditorContext& editorContext, const HitFilter& filter);
         private:
             class InvalidateAllIssuesVisitor;
             void invalidateAllIssues();
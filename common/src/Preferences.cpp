@@ -38,6 +38,9 @@ namespace TrenchBroom {
         Preference<Color> PointFileColor(IO::Path("Renderer/Colors/Point file"), Color(0.0f, 1.0f, 0.0f, 1.0f));
         Preference<Color> PortalFileBorderColor(IO::Path("Renderer/Colors/Portal file border"), Color(1.0f, 1.0f, 1.0f, 0.5f));
         Preference<Color> PortalFileFillColor(IO::Path("Renderer/Colors/Portal file fill"), Color(1.0f, 0.4f, 0.4f, 0.2f));
+        // the maximum number of portals rendered around the camera, or 0 to render all visible portals; this setting
+        // is not shown in the preferences dialog and can only be changed by editing the preferences file
+        Preference<int> PortalFileMaxPortals(IO::Path("Renderer/Portal file maximum portals"), 0);
 
         Preference<Color>& axisColor(vm::axis::type axis) {
             switch (axis) {
@@ -194,6 +197,7 @@ namespace TrenchBroom {
                 &PointFileColor,
                 &PortalFileBorderColor,
                 &PortalFileFillColor,
+                &PortalFileMaxPortals,
                 &CompassBackgroundColor,
                 &CompassBackgroundOutlineColor,
                 &CompassAxisOutlineColor,
@@ -44,6 +44,7 @@ namespace TrenchBroom {
         extern Preference<Color> PointFileColor;
         extern Preference<Color> PortalFileBorderColor;
         extern Preference<Color> PortalFileFillColor;
+        extern Preference<int> PortalFileMaxPortals;
 
         Preference<Color>& axisColor(vm::axis::type axis);
 
@@ -327,6 +327,7 @@ namespace TrenchBroom {
         void BrushRenderer::validate() {
             assert(!valid());
 
+            m_statistics = Statistics();
             for (auto brush : m_invalidBrushes) {
                 validateBrush(brush);
             }
@@ -338,6 +339,10 @@ namespace TrenchBroom {
             m_edgeRenderer = IndexedEdgeRenderer(m_vertexArray, m_edgeIndices);
         }
 
+        const BrushRenderer::Statistics& BrushRenderer::statistics() const {
+            return m_statistics;
+        }
+
         static size_t triIndicesCountForPolygon(const size_t vertexCount) {
             assert(vertexCount >= 3);
             const size_t indexCount = 3 * (vertexCount - 2);
@@ -435,6 +440,8 @@ namespace TrenchBroom {
             const auto settings = wrapper.markFaces(brush);
             const auto [facePolicy, edgePolicy] = settings;
 
+            ++m_statistics.validatedBrushes;
+
             if (facePolicy == Filter::FaceRenderPolicy::RenderNone &&
                 edgePolicy == Filter::EdgeRenderPolicy::RenderNone) {
                 // NOTE: this skips inserting the brush into m_brushInfo
@@ -445,9 +452,10 @@ namespace TrenchBroom {
 
             // collect vertices
             auto& brushCache = brush->brushRendererBrushCache();
-            brushCache.validateVertexCache(brush);
+            m_statistics.regeneratedVertices += brushCache.validateVertexCache(brush);
             const auto& cachedVertices = brushCache.cachedVertices();
             ensure(!cachedVertices.empty(), "Brush must have cached vertices");
+            m_statistics.uploadedVertices += cachedVertices.size();
 
             assert(m_vertexArray != nullptr);
             auto [vertBlock, dest] = m_vertexArray->getPointerToInsertVerticesAt(cachedVertices.size());
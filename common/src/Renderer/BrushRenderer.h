@@ -113,6 +113,18 @@ namespace TrenchBroom {
             private:
                 deleteCopyAndMove(NoFilter)
             };
+            /**
+             * Counts the work done by one call to validate(). Since the invalid brushes are validated at most once
+             * per frame, these are the counts for the last frame in which any brush was validated.
+             */
+            struct Statistics {
+                /** The number of brushes that were validated. */
+                size_t validatedBrushes = 0u;
+                /** The number of vertices that were regenerated because a brush's vertex cache was invalid. */
+                size_t regeneratedVertices = 0u;
+                /** The number of vertices that were copied into the vertex array. */
+                size_t uploadedVertices = 0u;
+            };
         private:
             class FilterWrapper;
         private:
@@ -162,6 +174,8 @@ namespace TrenchBroom {
             float m_transparencyAlpha;
 
             bool m_showHiddenBrushes;
+
+            Statistics m_statistics;
         public:
             template <typename FilterT>
             explicit BrushRenderer(const FilterT& filter) :
@@ -280,6 +294,11 @@ namespace TrenchBroom {
              * Only exposed for benchmarking.
              */
             void validate();
+
+            /**
+             * Returns the counters of the most recent call to validate().
+             */
+            const Statistics& statistics() const;
         private:
             bool shouldDrawFaceInTransparentPass(const Model::Brush* brush, const Model::BrushFace* face) const;
             void validateBrush(const Model::Brush* brush);
@@ -45,18 +45,40 @@ namespace TrenchBroom {
                   vertexIndex2RelativeToBrush(i_vertexIndex2RelativeToBrush) {}
 
         BrushRendererBrushCache::BrushRendererBrushCache()
-                : m_rendererCacheValid(false) {}
+                : m_rendererCacheValid(false),
+                  m_textureCacheValid(false) {}
 
         void BrushRendererBrushCache::invalidateVertexCache() {
             m_rendererCacheValid = false;
+            m_textureCacheValid = false;
             m_cachedVertices.clear();
             m_cachedEdges.clear();
             m_cachedFacesSortedByTexture.clear();
         }
 
-        void BrushRendererBrushCache::validateVertexCache(const Model::Brush* brush) {
+        void BrushRendererBrushCache::invalidateTextureCache() {
+            m_textureCacheValid = false;
+        }
+
+        static void sortFacesByTexture(std::vector<BrushRendererBrushCache::CachedFace>& faces) {
+            // Sort by texture so BrushRenderer can efficiently step through the BrushFaces
+            // grouped by texture (via `BrushRendererBrushCache::cachedFacesSortedByTexture()`), without needing to build an std::map
+
+            std::sort(faces.begin(),
+                      faces.end(),
+                      [](const BrushRendererBrushCache::CachedFace& a, const BrushRendererBrushCache::CachedFace& b){ return a.texture < b.texture; });
+        }
+
+        size_t BrushRendererBrushCache::validateVertexCache(const Model::Brush* brush) {
             if (m_rendererCacheValid) {
-                return;
+                if (!m_textureCacheValid) {
+                    for (auto& cachedFace : m_cachedFacesSortedByTexture) {
+                        cachedFace.texture = cachedFace.face->texture();
+                    }
+                    sortFacesByTexture(m_cachedFacesSortedByTexture);
+                    m_textureCacheValid = true;
+                }
+                return 0u;
             }
 
             // build vertex cache and face cache
@@ -67,9 +89,15 @@ namespace TrenchBroom {
             m_cachedFacesSortedByTexture.clear();
             m_cachedFacesSortedByTexture.reserve(brush->faceCount());
 
+            // the positions and texture coordinates of the current face, so that they can be computed in one batch
+            std::vector<vm::vec3> positions;
+            std::vector<vm::vec2f> texCoords;
+
             for (Model::BrushFace* face : brush->faces()) {
                 const auto indexOfFirstVertexRelativeToBrush = m_cachedVertices.size();
 
+                positions.clear();
+
                 // The boundary is in CCW order, but the renderer expects CW order:
                 auto& boundary = face->geometry()->boundary();
                 for (auto it = std::rbegin(boundary), end = std::rend(boundary); it != end; ++it) {
@@ -80,25 +108,25 @@ namespace TrenchBroom {
                     // This is used below when building the edge cache.
                     // NOTE: we'll overwrite the payload as we visit the same vertex several times while visiting
                     // different faces, this is fine.
-                    const auto currentIndex = m_cachedVertices.size();
+                    const auto currentIndex = indexOfFirstVertexRelativeToBrush + positions.size();
                     vertex->setPayload(static_cast<GLuint>(currentIndex));
 
-                    const auto& position = vertex->position();
-                    m_cachedVertices.emplace_back(vm::vec3f(position), vm::vec3f(face->boundary().normal), face->textureCoords(position));
+                    positions.push_back(vertex->position());
+                }
+
+                texCoords.resize(positions.size());
+                face->textureCoords(positions.data(), positions.size(), texCoords.data());
 
-                    current = current->previous();
+                const auto normal = vm::vec3f(face->boundary().normal);
+                for (size_t i = 0; i < positions.size(); ++i) {
+                    m_cachedVertices.emplace_back(vm::vec3f(positions[i]), normal, texCoords[i]);
                 }
 
                 // face cache
                 m_cachedFacesSortedByTexture.emplace_back(face, indexOfFirstVertexRelativeToBrush);
             }
 
-            // Sort by texture so BrushRenderer can efficiently step through the BrushFaces
-            // grouped by texture (via `BrushRendererBrushCache::cachedFacesSortedByTexture()`), without needing to build an std::map
-
-            std::sort(m_cachedFacesSortedByTexture.begin(),
-                      m_cachedFacesSortedByTexture.end(),
-                      [](const CachedFace& a, const CachedFace& b){ return a.texture < b.texture; });
+            sortFacesByTexture(m_cachedFacesSortedByTexture);
 
             // Build edge index cache
 
@@ -115,6 +143,8 @@ namespace TrenchBroom {
             }
 
             m_rendererCacheValid = true;
+            m_textureCacheValid = true;
+            return m_cachedVertices.size();
         }
 
         const std::vector<BrushRendererBrushCache::Vertex>& BrushRendererBrushCache::cachedVertices() const {
@@ -123,7 +153,7 @@ namespace TrenchBroom {
         }
 
         const std::vector<BrushRendererBrushCache::CachedFace>& BrushRendererBrushCache::cachedFacesSortedByTexture() const {
-            assert(m_rendererCacheValid);
+            assert(m_rendererCacheValid && m_textureCacheValid);
             return m_cachedFacesSortedByTexture;
         }
 
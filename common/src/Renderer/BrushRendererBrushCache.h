@@ -67,6 +67,7 @@ namespace TrenchBroom {
             std::vector<CachedEdge> m_cachedEdges;
             std::vector<CachedFace> m_cachedFacesSortedByTexture;
             bool m_rendererCacheValid;
+            bool m_textureCacheValid;
 
         public:
             BrushRendererBrushCache();
@@ -75,15 +76,24 @@ namespace TrenchBroom {
              * Only exposed to be called by BrushFace
              */
             void invalidateVertexCache();
+            /**
+             * Only exposed to be called by BrushFace. Call this if a face's texture was replaced by a texture of the
+             * same size. The cached vertices remain valid because the texture coordinates only depend on the texture
+             * size, but the faces must be regrouped by texture.
+             */
+            void invalidateTextureCache();
             /**
              * Call this before cachedVertices()/cachedFacesSortedByTexture()/cachedEdges()
              *
              * NOTE: The reason for having this cache is we often need to re-upload the brush to VBO's when the brush
              * itself hasn't changed, but we're moving it between VBO's for different rendering styles
              * (default/selected/locked), or need to re-evaluate the BrushRenderer::Filter to exclude certain
-             * faces/edges.
+             * faces/edges. Selection and marking changes only affect the index lists that BrushRenderer builds from
+             * this cache, so they never cause the vertices to be regenerated.
+             *
+             * @return the number of vertices that were regenerated, which is 0 if the vertex cache was valid
              */
-            void validateVertexCache(const Model::Brush* brush);
+            size_t validateVertexCache(const Model::Brush* brush);
 
             /**
              * Returns all vertices for all faces of the brush.
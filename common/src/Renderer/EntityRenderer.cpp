@@ -41,6 +41,8 @@
 #include <vecmath/mat_ext.h>
 #include <vecmath/scalar.h>
 
+#include <kdl/vector_set.h>
+
 #include <vector>
 
 namespace TrenchBroom {
@@ -88,6 +90,22 @@ namespace TrenchBroom {
             reloadModels();
         }
 
+        void EntityRenderer::invalidateEntities(const std::vector<Model::Entity*>& entities) {
+            const auto entitySet = kdl::vector_set<Model::Entity*>(std::begin(entities), std::end(entities));
+
+            auto invalidated = false;
+            for (auto* entity : m_entities) {
+                if (entitySet.count(entity) > 0) {
+                    m_modelRenderer.updateEntity(entity);
+                    invalidated = true;
+                }
+            }
+
+            if (invalidated) {
+                invalidateBounds();
+            }
+        }
+
         void EntityRenderer::clear() {
             m_entities.clear();
             m_pointEntityWireframeBoundsRenderer = DirectEdgeRenderer();
@@ -76,6 +76,11 @@ namespace TrenchBroom {
 
             void setEntities(const std::vector<Model::Entity*>& entities);
             void invalidate();
+            /**
+             * Updates the models and bounds of those of the given entities that are rendered by this renderer. The
+             * other entities are ignored.
+             */
+            void invalidateEntities(const std::vector<Model::Entity*>& entities);
             void clear();
             void reloadModels();
 
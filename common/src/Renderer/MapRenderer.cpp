@@ -415,6 +415,18 @@ namespace TrenchBroom {
             }
         }
 
+        void MapRenderer::invalidateEntitiesInRenderers(Renderer renderers, const std::vector<Model::Entity*>& entities) {
+            if ((renderers & Renderer_Default) != 0) {
+                m_defaultRenderer->invalidateEntities(entities);
+            }
+            if ((renderers & Renderer_Selection) != 0) {
+                m_selectionRenderer->invalidateEntities(entities);
+            }
+            if ((renderers& Renderer_Locked) != 0) {
+                m_lockedRenderer->invalidateEntities(entities);
+            }
+        }
+
         void MapRenderer::invalidateEntityLinkRenderer() {
             m_entityLinkRenderer->invalidate();
         }
@@ -442,6 +454,7 @@ namespace TrenchBroom {
             document->selectionDidChangeNotifier.addObserver(this, &MapRenderer::selectionDidChange);
             document->textureCollectionsWillChangeNotifier.addObserver(this, &MapRenderer::textureCollectionsWillChange);
             document->entityDefinitionsDidChangeNotifier.addObserver(this, &MapRenderer::entityDefinitionsDidChange);
+            document->entityModelsWereLoadedNotifier.addObserver(this, &MapRenderer::entityModelsWereLoaded);
             document->modsDidChangeNotifier.addObserver(this, &MapRenderer::modsDidChange);
             document->editorContextDidChangeNotifier.addObserver(this, &MapRenderer::editorContextDidChange);
             document->mapViewConfigDidChangeNotifier.addObserver(this, &MapRenderer::mapViewConfigDidChange);
@@ -467,6 +480,7 @@ namespace TrenchBroom {
                 document->selectionDidChangeNotifier.removeObserver(this, &MapRenderer::selectionDidChange);
                 document->textureCollectionsWillChangeNotifier.removeObserver(this, &MapRenderer::textureCollectionsWillChange);
                 document->entityDefinitionsDidChangeNotifier.removeObserver(this, &MapRenderer::entityDefinitionsDidChange);
+                document->entityModelsWereLoadedNotifier.removeObserver(this, &MapRenderer::entityModelsWereLoaded);
                 document->modsDidChangeNotifier.removeObserver(this, &MapRenderer::modsDidChange);
                 document->editorContextDidChangeNotifier.removeObserver(this, &MapRenderer::editorContextDidChange);
                 document->mapViewConfigDidChangeNotifier.removeObserver(this, &MapRenderer::mapViewConfigDidChange);
@@ -553,6 +567,12 @@ namespace TrenchBroom {
             invalidateEntityLinkRenderer();
         }
 
+        void MapRenderer::entityModelsWereLoaded(const std::vector<IO::Path>& /* paths */, const std::vector<Model::Entity*>& entities) {
+            if (!entities.empty()) {
+                invalidateEntitiesInRenderers(Renderer_All, entities);
+            }
+        }
+
         void MapRenderer::modsDidChange() {
             reloadEntityModels();
             invalidateRenderers(Renderer_All);
@@ -42,6 +42,7 @@ namespace TrenchBroom {
     namespace Model {
         class Brush;
         class BrushFace;
+        class Entity;
         class Group;
         class Layer;
         class Node;
@@ -119,6 +120,7 @@ namespace TrenchBroom {
             void updateRenderers(Renderer renderers);
             void invalidateRenderers(Renderer renderers);
             void invalidateBrushesInRenderers(Renderer renderers, const std::vector<Model::Brush*>& brushes);
+            void invalidateEntitiesInRenderers(Renderer renderers, const std::vector<Model::Entity*>& entities);
             void invalidateEntityLinkRenderer();
             void reloadEntityModels();
         private: // notification
@@ -144,6 +146,7 @@ namespace TrenchBroom {
 
             void textureCollectionsWillChange();
             void entityDefinitionsDidChange();
+            void entityModelsWereLoaded(const std::vector<IO::Path>& paths, const std::vector<Model::Entity*>& entities);
             void modsDidChange();
 
             void editorContextDidChange();
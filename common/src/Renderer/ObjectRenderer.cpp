@@ -39,6 +39,12 @@ namespace TrenchBroom {
             m_brushRenderer.invalidateBrushes(brushes);
         }
 
+        void ObjectRenderer::invalidateEntities(const std::vector<Model::Entity*>& entities) {
+            // the bounds of a group depend on the bounds of the entities it contains
+            m_groupRenderer.invalidate();
+            m_entityRenderer.invalidateEntities(entities);
+        }
+
         void ObjectRenderer::clear() {
             m_groupRenderer.clear();
             m_entityRenderer.clear();
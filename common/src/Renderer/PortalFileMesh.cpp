@@ -0,0 +1,215 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PortalFileMesh.h"
+
+#include <kdl/parallel.h>
+
+#include <vecmath/bbox.h>
+#include <vecmath/plane.h>
+#include <vecmath/polygon.h>
+#include <vecmath/vec.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+
+namespace TrenchBroom {
+    namespace Renderer {
+        PortalFileMesh::Bucket::Bucket() :
+        portalCount(0u),
+        triangleIndex(0u),
+        triangleCount(0u),
+        lineIndex(0u),
+        lineCount(0u) {}
+
+        static size_t triangleVertexCount(const vm::polygon3f& portal) {
+            return portal.vertexCount() >= 3u ? 3u * (portal.vertexCount() - 2u) : 0u;
+        }
+
+        static size_t lineVertexCount(const vm::polygon3f& portal) {
+            return portal.vertexCount() >= 2u ? 2u * portal.vertexCount() : 0u;
+        }
+
+        static vm::bbox3f portalBounds(const vm::polygon3f& portal) {
+            const auto& vertices = portal.vertices();
+            auto min = vertices.front();
+            auto max = vertices.front();
+            for (const auto& vertex : vertices) {
+                min = vm::min(min, vertex);
+                max = vm::max(max, vertex);
+            }
+            return vm::bbox3f(min, max);
+        }
+
+        PortalFileMesh::PortalFileMesh(const std::vector<vm::polygon3f>& portals, const float bucketSize) {
+            using BucketKey = std::tuple<int, int, int>;
+
+            // assign every portal to the grid cell containing its center
+            const auto bounds = kdl::parallel_transform(std::begin(portals), std::end(portals), [](const vm::polygon3f& portal) {
+                return portal.vertexCount() > 0u ? portalBounds(portal) : vm::bbox3f();
+            });
+
+            std::map<BucketKey, size_t> bucketIndices;
+            std::vector<size_t> portalBuckets;
+            portalBuckets.reserve(portals.size());
+
+            for (size_t i = 0u; i < portals.size(); ++i) {
+                const auto center = bounds[i].center() / bucketSize;
+                const auto key = BucketKey(
+                    static_cast<int>(std::floor(center.x())),
+                    static_cast<int>(std::floor(center.y())),
+                    static_cast<int>(std::floor(center.z())));
+
+                const auto [it, inserted] = bucketIndices.try_emplace(key, m_buckets.size());
+                if (inserted) {
+                    m_buckets.emplace_back();
+                    m_buckets.back().bounds = bounds[i];
+                }
+
+                auto& bucket = m_buckets[it->second];
+                bucket.bounds = vm::bbox3f(vm::min(bucket.bounds.min, bounds[i].min), vm::max(bucket.bounds.max, bounds[i].max));
+                bucket.portalCount += 1u;
+                bucket.triangleCount += triangleVertexCount(portals[i]);
+                bucket.lineCount += lineVertexCount(portals[i]);
+                portalBuckets.push_back(it->second);
+            }
+
+            // lay out the faces of all buckets followed by the outlines of all buckets
+            size_t vertexCount = 0u;
+            for (auto& bucket : m_buckets) {
+                bucket.triangleIndex = vertexCount;
+                vertexCount += bucket.triangleCount;
+            }
+            for (auto& bucket : m_buckets) {
+                bucket.lineIndex = vertexCount;
+                vertexCount += bucket.lineCount;
+            }
+
+            // determine where the vertices of every portal go
+            std::vector<size_t> triangleOffsets;
+            std::vector<size_t> lineOffsets;
+            triangleOffsets.reserve(portals.size());
+            lineOffsets.reserve(portals.size());
+
+            auto bucketTriangleOffsets = std::vector<size_t>(m_buckets.size());
+            auto bucketLineOffsets = std::vector<size_t>(m_buckets.size());
+            for (size_t i = 0u; i < m_buckets.size(); ++i) {
+                bucketTriangleOffsets[i] = m_buckets[i].triangleIndex;
+                bucketLineOffsets[i] = m_buckets[i].lineIndex;
+            }
+
+            for (size_t i = 0u; i < portals.size(); ++i) {
+                const auto bucketIndex = portalBuckets[i];
+                triangleOffsets.push_back(bucketTriangleOffsets[bucketIndex]);
+                lineOffsets.push_back(bucketLineOffsets[bucketIndex]);
+                bucketTriangleOffsets[bucketIndex] += triangleVertexCount(portals[i]);
+                bucketLineOffsets[bucketIndex] += lineVertexCount(portals[i]);
+            }
+
+            // every portal writes to its own range of vertices
+            m_vertices.resize(vertexCount);
+            kdl::parallel_for(portals.size(), [&](const size_t i) {
+                const auto& vertices = portals[i].vertices();
+                const auto count = vertices.size();
+
+                auto t = triangleOffsets[i];
+                for (size_t j = 1u; j + 1u < count; ++j) {
+                    m_vertices[t++] = Vertex(vertices[0]);
+                    m_vertices[t++] = Vertex(vertices[j]);
+                    m_vertices[t++] = Vertex(vertices[j + 1u]);
+                }
+
+                if (count >= 2u) {
+                    auto l = lineOffsets[i];
+                    for (size_t j = 0u; j < count; ++j) {
+                        m_vertices[l++] = Vertex(vertices[j]);
+                        m_vertices[l++] = Vertex(vertices[(j + 1u) % count]);
+                    }
+                }
+            });
+        }
+
+        const std::vector<PortalFileMesh::Vertex>& PortalFileMesh::vertices() const {
+            return m_vertices;
+        }
+
+        const std::vector<PortalFileMesh::Bucket>& PortalFileMesh::buckets() const {
+            return m_buckets;
+        }
+
+        size_t PortalFileMesh::portalCount() const {
+            size_t result = 0u;
+            for (const auto& bucket : m_buckets) {
+                result += bucket.portalCount;
+            }
+            return result;
+        }
+
+        static bool isAbovePlane(const vm::bbox3f& bounds, const vm::plane3f& plane) {
+            // the corner of the bounds which is farthest below the plane
+            auto corner = bounds.min;
+            for (size_t i = 0u; i < 3u; ++i) {
+                if (plane.normal[i] < 0.0f) {
+                    corner[i] = bounds.max[i];
+                }
+            }
+            return plane.point_distance(corner) > 0.0f;
+        }
+
+        static float squaredDistance(const vm::bbox3f& bounds, const vm::vec3f& position) {
+            auto closest = position;
+            for (size_t i = 0u; i < 3u; ++i) {
+                closest[i] = std::clamp(position[i], bounds.min[i], bounds.max[i]);
+            }
+            return vm::squared_length(position - closest);
+        }
+
+        std::vector<size_t> PortalFileMesh::visibleBuckets(const std::vector<vm::plane3f>& frustumPlanes, const vm::vec3f& position, const size_t maxPortals) const {
+            std::vector<size_t> result;
+            for (size_t i = 0u; i < m_buckets.size(); ++i) {
+                const auto& bounds = m_buckets[i].bounds;
+                const auto culled = std::any_of(std::begin(frustumPlanes), std::end(frustumPlanes), [&](const vm::plane3f& plane) {
+                    return isAbovePlane(bounds, plane);
+                });
+                if (!culled) {
+                    result.push_back(i);
+                }
+            }
+
+            if (maxPortals > 0u) {
+                std::sort(std::begin(result), std::end(result), [&](const size_t lhs, const size_t rhs) {
+                    return squaredDistance(m_buckets[lhs].bounds, position) < squaredDistance(m_buckets[rhs].bounds, position);
+                });
+
+                size_t portalCount = 0u;
+                auto it = std::begin(result);
+                // the closest bucket is always returned, even if it alone exceeds the maximum
+                while (it != std::end(result) && (it == std::begin(result) || portalCount + m_buckets[*it].portalCount <= maxPortals)) {
+                    portalCount += m_buckets[*it].portalCount;
+                    ++it;
+                }
+                result.erase(it, std::end(result));
+            }
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TrenchBroom_PortalFileMesh
+#define TrenchBroom_PortalFileMesh
+
+#include "Renderer/GLVertexType.h"
+
+#include <vecmath/forward.h>
+#include <vecmath/bbox.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Renderer {
+        /**
+         * Prepares the portals of a portal file for rendering. The portals are assigned to buckets, which are the cells
+         * of a regular grid containing the portals' centers. The portals of every bucket are stored in a contiguous
+         * range of triangles and a contiguous range of line segments, so that all portals of a bucket can be rendered
+         * with one draw call for their faces and one for their outlines, and so that invisible buckets can be culled
+         * as a whole.
+         *
+         * The vertices contain the faces of all buckets followed by the outlines of all buckets.
+         */
+        class PortalFileMesh {
+        public:
+            using Vertex = GLVertexTypes::P3::Vertex;
+
+            struct Bucket {
+                vm::bbox3f bounds;
+                size_t portalCount;
+                size_t triangleIndex;
+                size_t triangleCount;
+                size_t lineIndex;
+                size_t lineCount;
+
+                Bucket();
+            };
+        private:
+            std::vector<Vertex> m_vertices;
+            std::vector<Bucket> m_buckets;
+        public:
+            /**
+             * Creates a mesh for the given portals. The faces of the portals are triangulated and their outlines are
+             * converted into line segments in parallel.
+             *
+             * @param portals the portals
+             * @param bucketSize the edge length of the grid cells that determine the buckets
+             */
+            explicit PortalFileMesh(const std::vector<vm::polygon3f>& portals, float bucketSize = 1024.0f);
+
+            const std::vector<Vertex>& vertices() const;
+            const std::vector<Bucket>& buckets() const;
+            size_t portalCount() const;
+
+            /**
+             * Returns the indices of the buckets which are not entirely above any of the given frustum planes.
+             *
+             * If the given maximum number of portals is not 0, the buckets are sorted by their distance from the given
+             * position, and only the closest buckets are returned such that their total number of portals does not
+             * exceed the maximum. The closest visible bucket is always returned, even if it alone exceeds the maximum.
+             *
+             * @param frustumPlanes the planes bounding the view frustum, with their normals pointing outwards
+             * @param position the position of the viewer
+             * @param maxPortals the maximum number of portals to return buckets for, or 0 to return all visible buckets
+             * @return the indices of the visible buckets
+             */
+            std::vector<size_t> visibleBuckets(const std::vector<vm::plane3f>& frustumPlanes, const vm::vec3f& position, size_t maxPortals) const;
+        };
+    }
+}
+
+#endif /* defined(TrenchBroom_PortalFileMesh) */
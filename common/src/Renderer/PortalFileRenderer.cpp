@@ -0,0 +1,108 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PortalFileRenderer.h"
+
+#include "Renderer/ActiveShader.h"
+#include "Renderer/Camera.h"
+#include "Renderer/GL.h"
+#include "Renderer/PrimType.h"
+#include "Renderer/RenderContext.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/Shaders.h"
+
+#include <vecmath/plane.h>
+#include <vecmath/vec.h>
+
+#include <utility>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Renderer {
+        PortalFileRenderer::PortalFileRenderer(PortalFileMesh mesh, const Color& fillColor, const Color& borderColor, const float lineWidth, const size_t maxPortals) :
+        m_mesh(std::move(mesh)),
+        m_vertexArray(VertexArray::ref(m_mesh.vertices())),
+        m_fillColor(fillColor),
+        m_borderColor(borderColor),
+        m_lineWidth(lineWidth),
+        m_maxPortals(maxPortals) {}
+
+        void PortalFileRenderer::doPrepareVertices(VboManager& vboManager) {
+            m_vertexArray.prepare(vboManager);
+        }
+
+        void PortalFileRenderer::doRender(RenderContext& renderContext) {
+            if (m_vertexArray.empty()) {
+                return;
+            }
+
+            const auto& camera = renderContext.camera();
+            auto frustumPlanes = std::vector<vm::plane3f>(4u);
+            camera.frustumPlanes(frustumPlanes[0], frustumPlanes[1], frustumPlanes[2], frustumPlanes[3]);
+
+            const auto bucketIndices = m_mesh.visibleBuckets(frustumPlanes, camera.position(), m_maxPortals);
+            if (bucketIndices.empty()) {
+                return;
+            }
+
+            GLIndices triangleIndices, lineIndices;
+            GLCounts triangleCounts, lineCounts;
+            triangleIndices.reserve(bucketIndices.size());
+            triangleCounts.reserve(bucketIndices.size());
+            lineIndices.reserve(bucketIndices.size());
+            lineCounts.reserve(bucketIndices.size());
+
+            for (const auto i : bucketIndices) {
+                const auto& bucket = m_mesh.buckets()[i];
+                triangleIndices.push_back(static_cast<GLint>(bucket.triangleIndex));
+                triangleCounts.push_back(static_cast<GLsizei>(bucket.triangleCount));
+                lineIndices.push_back(static_cast<GLint>(bucket.lineIndex));
+                lineCounts.push_back(static_cast<GLsizei>(bucket.lineCount));
+            }
+
+            const auto primCount = static_cast<GLint>(bucketIndices.size());
+
+            ActiveShader shader(renderContext.shaderManager(), Shaders::VaryingPUniformCShader);
+            if (m_vertexArray.setup()) {
+                // render the faces from both sides, and don't let translucent faces occlude each other
+                glAssert(glPushAttrib(GL_POLYGON_BIT))
+                glAssert(glDisable(GL_CULL_FACE))
+                glAssert(glPolygonMode(GL_FRONT_AND_BACK, GL_FILL))
+                if (m_fillColor.a() < 1.0f) {
+                    glAssert(glDepthMask(GL_FALSE))
+                }
+
+                shader.set("Color", m_fillColor);
+                m_vertexArray.render(PrimType::Triangles, triangleIndices, triangleCounts, primCount);
+
+                if (m_fillColor.a() < 1.0f) {
+                    glAssert(glDepthMask(GL_TRUE))
+                }
+                glAssert(glPopAttrib())
+
+                glAssert(glLineWidth(m_lineWidth))
+                shader.set("Color", m_borderColor);
+                m_vertexArray.render(PrimType::Lines, lineIndices, lineCounts, primCount);
+                glAssert(glLineWidth(1.0f))
+
+                m_vertexArray.cleanup();
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TrenchBroom_PortalFileRenderer
+#define TrenchBroom_PortalFileRenderer
+
+#include "Color.h"
+#include "Macros.h"
+#include "Renderer/PortalFileMesh.h"
+#include "Renderer/Renderable.h"
+#include "Renderer/VertexArray.h"
+
+#include <cstddef>
+
+namespace TrenchBroom {
+    namespace Renderer {
+        class RenderContext;
+        class VboManager;
+
+        /**
+         * Renders the portals of a portal file. Buckets of portals which are outside of the view frustum are culled,
+         * and the faces and outlines of the remaining buckets are each rendered with a single draw call.
+         */
+        class PortalFileRenderer : public DirectRenderable {
+        private:
+            PortalFileMesh m_mesh;
+            VertexArray m_vertexArray;
+
+            Color m_fillColor;
+            Color m_borderColor;
+            float m_lineWidth;
+            size_t m_maxPortals;
+        public:
+            /**
+             * Creates a new renderer for the given mesh.
+             *
+             * @param mesh the mesh to render
+             * @param fillColor the color of the portal faces
+             * @param borderColor the color of the portal outlines
+             * @param lineWidth the width of the portal outlines
+             * @param maxPortals the maximum number of portals to render, or 0 to render all visible portals; if the
+             * visible portals exceed this number, only the buckets closest to the camera are rendered
+             */
+            PortalFileRenderer(PortalFileMesh mesh, const Color& fillColor, const Color& borderColor, float lineWidth, size_t maxPortals);
+
+            deleteCopyAndMove(PortalFileRenderer)
+        private:
+            void doPrepareVertices(VboManager& vboManager) override;
+            void doRender(RenderContext& renderContext) override;
+        };
+    }
+}
+
+#endif /* defined(TrenchBroom_PortalFileRenderer) */
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <vector>
 
 #include <QVariant>
@@ -410,15 +411,16 @@ namespace TrenchBroom {
                 }
             }
 
+            /**
+             * Returns the index of the first row whose bottom is below the given y coordinate, or the number of rows
+             * if there is no such row. Since the rows are ordered from top to bottom, this is a binary search, so
+             * the visible rows of very large groups can be found without visiting all rows above them.
+             */
             size_t indexOfRowAt(const float y) const {
-                for (size_t i = 0; i < m_rows.size(); ++i) {
-                    const Row& row = m_rows[i];
-                    const LayoutBounds& rowBounds = row.bounds();
-                    if (y < rowBounds.bottom())
-                        return i;
-                }
-
-                return m_rows.size();
+                const auto it = std::partition_point(std::begin(m_rows), std::end(m_rows), [&](const Row& row) {
+                    return y >= row.bounds().bottom();
+                });
+                return static_cast<size_t>(std::distance(std::begin(m_rows), it));
             }
 
             bool rowAt(const float y, const Row** result) const {
@@ -431,18 +433,14 @@ namespace TrenchBroom {
             }
 
             bool cellAt(const float x, const float y, const LayoutCell** result) const {
-                for (size_t i = 0; i < m_rows.size(); ++i) {
-                    const Row& row = m_rows[i];
-                    const LayoutBounds& rowBounds = row.bounds();
-                    if (y > rowBounds.bottom())
-                        continue;
-                    else if (y < rowBounds.top())
-                        break;
-                    if (row.cellAt(x, y, result))
-                        return true;
-                }
+                const size_t index = indexOfRowAt(y);
+                if (index == m_rows.size())
+                    return false;
 
-                return false;
+                const Row& row = m_rows[index];
+                if (y < row.bounds().top())
+                    return false;
+                return row.cellAt(x, y, result);
             }
 
             bool hitTest(const float x, const float y) const {
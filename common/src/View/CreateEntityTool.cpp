@@ -27,8 +27,7 @@
 #include "Model/BrushFace.h"
 #include "Model/Entity.h"
 #include "Model/HitAdapter.h"
-#include "Model/HitQuery.h"
-#include "Model/PickResult.h"
+#include "Model/HitFilter.h"
 #include "Model/World.h"
 #include "Renderer/Camera.h"
 #include "View/Grid.h"
@@ -37,6 +36,7 @@
 #include <kdl/memory_utils.h>
 #include <vecmath/bbox.h>
 
+#include <memory>
 #include <string>
 
 namespace TrenchBroom {
@@ -107,14 +107,17 @@ namespace TrenchBroom {
             }
         }
 
-        void CreateEntityTool::updateEntityPosition3D(const vm::ray3& pickRay, const Model::PickResult& pickResult) {
+        void CreateEntityTool::updateEntityPosition3D(const vm::ray3& pickRay) {
             ensure(m_entity != nullptr, "entity is null");
 
             auto document = kdl::mem_lock(m_document);
 
             vm::vec3 delta;
             const auto& grid = document->grid();
-            const auto& hit = pickResult.query().pickable().type(Model::Brush::BrushHit).occluded().first();
+            const auto filter = Model::HitFilterChain(
+                std::make_unique<Model::ContextHitFilter>(document->editorContext()),
+                std::make_unique<Model::TypedHitFilter>(Model::Brush::BrushHit));
+            const auto hit = document->pickClosest(pickRay, filter);
             if (hit.isMatch()) {
                 const auto* face = Model::hitToFace(hit);
                 const auto dragPlane = vm::aligned_orthogonal_plane(hit.hitPoint(), face->boundary().normal);
@@ -31,7 +31,6 @@
 namespace TrenchBroom {
     namespace Model {
         class Entity;
-        class PickResult;
     }
 
     namespace View {
@@ -50,7 +49,7 @@ namespace TrenchBroom {
             void commitEntity();
 
             void updateEntityPosition2D(const vm::ray3& pickRay);
-            void updateEntityPosition3D(const vm::ray3& pickRay, const Model::PickResult& pickResult);
+            void updateEntityPosition3D(const vm::ray3& pickRay);
         };
     }
 }
@@ -88,7 +88,7 @@ namespace TrenchBroom {
         CreateEntityToolController(tool) {}
 
         void CreateEntityToolController3D::doUpdateEntityPosition(const InputState& inputState) {
-            m_tool->updateEntityPosition3D(inputState.pickRay(), inputState.pickResult());
+            m_tool->updateEntityPosition3D(inputState.pickRay());
         }
     }
 }
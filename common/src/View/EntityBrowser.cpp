@@ -23,12 +23,14 @@
 #include "Preferences.h"
 #include "Assets/EntityDefinition.h"
 #include "Assets/EntityDefinitionManager.h"
+#include "IO/Path.h"
 #include "View/EntityBrowserView.h"
 #include "View/ViewConstants.h"
 #include "View/MapDocument.h"
 #include "View/QtUtils.h"
 
 #include <kdl/memory_utils.h>
+#include <kdl/vector_set.h>
 
 #include <QtGlobal>
 #include <QPushButton>
@@ -139,6 +141,7 @@ namespace TrenchBroom {
             document->documentWasLoadedNotifier.addObserver(this, &EntityBrowser::documentWasLoaded);
             document->modsDidChangeNotifier.addObserver(this, &EntityBrowser::modsDidChange);
             document->entityDefinitionsDidChangeNotifier.addObserver(this, &EntityBrowser::entityDefinitionsDidChange);
+            document->entityModelsWereLoadedNotifier.addObserver(this, &EntityBrowser::entityModelsWereLoaded);
 
             PreferenceManager& prefs = PreferenceManager::instance();
             prefs.preferenceDidChangeNotifier.addObserver(this, &EntityBrowser::preferenceDidChange);
@@ -151,6 +154,7 @@ namespace TrenchBroom {
                 document->documentWasLoadedNotifier.removeObserver(this, &EntityBrowser::documentWasLoaded);
                 document->modsDidChangeNotifier.removeObserver(this, &EntityBrowser::modsDidChange);
                 document->entityDefinitionsDidChangeNotifier.removeObserver(this, &EntityBrowser::entityDefinitionsDidChange);
+                document->entityModelsWereLoadedNotifier.removeObserver(this, &EntityBrowser::entityModelsWereLoaded);
             }
 
             PreferenceManager& prefs = PreferenceManager::instance();
@@ -173,6 +177,21 @@ namespace TrenchBroom {
             reload();
         }
 
+        void EntityBrowser::entityModelsWereLoaded(const std::vector<IO::Path>& paths, const std::vector<Model::Entity*>& /* entities */) {
+            // the layout depends on the model bounds, but only the default models of the point entities are shown
+            auto document = kdl::mem_lock(m_document);
+            const auto loadedPaths = kdl::vector_set<IO::Path>(std::begin(paths), std::end(paths));
+            for (const auto* definition : document->entityDefinitionManager().definitions()) {
+                if (definition->type() == Assets::EntityDefinitionType::PointEntity) {
+                    const auto* pointEntityDefinition = static_cast<const Assets::PointEntityDefinition*>(definition);
+                    if (loadedPaths.count(pointEntityDefinition->defaultModel().path) > 0) {
+                        reload();
+                        return;
+                    }
+                }
+            }
+        }
+
         void EntityBrowser::preferenceDidChange(const IO::Path& path) {
             auto document = kdl::mem_lock(m_document);
             if (document->isGamePathPreference(path)) {
@@ -21,6 +21,7 @@
 #define TrenchBroom_EntityBrowser
 
 #include <memory>
+#include <vector>
 
 #include <QWidget>
 
@@ -34,6 +35,10 @@ namespace TrenchBroom {
         class Path;
     }
 
+    namespace Model {
+        class Entity;
+    }
+
     namespace View {
         class EntityBrowserView;
         class GLContextManager;
@@ -65,6 +70,7 @@ namespace TrenchBroom {
 
             void modsDidChange();
             void entityDefinitionsDidChange();
+            void entityModelsWereLoaded(const std::vector<IO::Path>& paths, const std::vector<Model::Entity*>& entities);
             void preferenceDidChange(const IO::Path& path);
         };
     }
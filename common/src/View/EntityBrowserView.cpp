@@ -147,6 +147,10 @@ namespace TrenchBroom {
             assert(fontSize > 0);
 
             const Renderer::FontDescriptor font(fontPath, static_cast<size_t>(fontSize));
+            if (!m_titleCacheFont || m_titleCacheFont->compare(font) != 0) {
+                m_titleCache.clear();
+                m_titleCacheFont = font;
+            }
 
             if (m_group) {
                 for (const auto& group : m_entityDefinitionManager.groups()) {
@@ -185,9 +189,7 @@ namespace TrenchBroom {
             if ((!m_hideUnused || definition->usageCount() > 0) &&
                 (m_filterText.empty() || kdl::ci::str_contains(definition->name(), m_filterText))) {
 
-                const auto maxCellWidth = layout.maxCellWidth();
-                const auto actualFont = fontManager().selectFontSize(font, definition->name(), maxCellWidth, 5);
-                const auto actualSize = fontManager().font(actualFont).measure(definition->name());
+                const auto& title = cachedTitle(layout, definition, font);
 
                 const auto spec = definition->defaultModel();
                 const auto* frame = m_entityModelManager.frame(spec);
@@ -208,15 +210,30 @@ namespace TrenchBroom {
                 }
 
                 const auto boundsSize = rotatedBounds.size();
-                layout.addItem(QVariant::fromValue(std::make_shared<EntityCellData>(definition, modelRenderer, actualFont, rotatedBounds)),
+                layout.addItem(QVariant::fromValue(std::make_shared<EntityCellData>(definition, modelRenderer, title.font, rotatedBounds)),
                                boundsSize.y(),
                                boundsSize.z(),
-                               actualSize.x(),
+                               title.size.x(),
                                static_cast<float>(font.size()) + 2.0f);
             }
         }
 
-        void EntityBrowserView::doClear() {}
+        const EntityBrowserView::CachedTitle& EntityBrowserView::cachedTitle(const Layout& layout, const Assets::PointEntityDefinition* definition, const Renderer::FontDescriptor& font) {
+            auto it = m_titleCache.find(definition);
+            if (it != std::end(m_titleCache) && it->second.name == definition->name()) {
+                return it->second;
+            }
+
+            const auto maxCellWidth = layout.maxCellWidth();
+            const auto actualFont = fontManager().selectFontSize(font, definition->name(), maxCellWidth, 5);
+            const auto actualSize = fontManager().font(actualFont).measure(definition->name());
+
+            return m_titleCache.insert_or_assign(definition, CachedTitle{ definition->name(), actualFont, actualSize }).first->second;
+        }
+
+        void EntityBrowserView::doClear() {
+            m_titleCache.clear();
+        }
 
         void EntityBrowserView::doRender(Layout& layout, const float y, const float height) {
             const float viewLeft      = static_cast<float>(0);
@@ -261,20 +278,22 @@ namespace TrenchBroom {
             for (size_t i = 0; i < layout.size(); ++i) {
                 const auto& group = layout[i];
                 if (group.intersectsY(y, height)) {
-                    for (size_t j = 0; j < group.size(); ++j) {
+                    for (size_t j = group.indexOfRowAt(y); j < group.size(); ++j) {
                         const auto& row = group[j];
-                        if (row.intersectsY(y, height)) {
-                            for (size_t k = 0; k < row.size(); ++k) {
-                                const auto& cell = row[k];
-                                const auto* definition = cellData(cell).entityDefinition;
-                                auto* modelRenderer = cellData(cell).modelRenderer;
-
-                                if (modelRenderer == nullptr) {
-                                    const auto itemTrans = itemTransformation(cell, y, height);
-                                    const auto& color = definition->color();
-                                    CollectBoundsVertices<BoundsVertex> collect(itemTrans, color, vertices);
-                                    vm::bbox3f(definition->bounds()).for_each_edge(collect);
-                                }
+                        if (!row.intersectsY(y, height)) {
+                            break;
+                        }
+
+                        for (size_t k = 0; k < row.size(); ++k) {
+                            const auto& cell = row[k];
+                            const auto* definition = cellData(cell).entityDefinition;
+                            auto* modelRenderer = cellData(cell).modelRenderer;
+
+                            if (modelRenderer == nullptr) {
+                                const auto itemTrans = itemTransformation(cell, y, height);
+                                const auto& color = definition->color();
+                                CollectBoundsVertices<BoundsVertex> collect(itemTrans, color, vertices);
+                                vm::bbox3f(definition->bounds()).for_each_edge(collect);
                             }
                         }
                     }
@@ -301,18 +320,20 @@ namespace TrenchBroom {
             for (size_t i = 0; i < layout.size(); ++i) {
                 const auto& group = layout[i];
                 if (group.intersectsY(y, height)) {
-                    for (size_t j = 0; j < group.size(); ++j) {
+                    for (size_t j = group.indexOfRowAt(y); j < group.size(); ++j) {
                         const auto& row = group[j];
-                        if (row.intersectsY(y, height)) {
-                            for (size_t k = 0; k < row.size(); ++k) {
-                                const auto& cell = row[k];
-                                auto* modelRenderer = cellData(cell).modelRenderer;
-
-                                if (modelRenderer != nullptr) {
-                                    const auto itemTrans = itemTransformation(cell, y, height);
-                                    Renderer::MultiplyModelMatrix multMatrix(transformation, itemTrans);
-                                    modelRenderer->render();
-                                }
+                        if (!row.intersectsY(y, height)) {
+                            break;
+                        }
+
+                        for (size_t k = 0; k < row.size(); ++k) {
+                            const auto& cell = row[k];
+                            auto* modelRenderer = cellData(cell).modelRenderer;
+
+                            if (modelRenderer != nullptr) {
+                                const auto itemTrans = itemTransformation(cell, y, height);
+                                Renderer::MultiplyModelMatrix multMatrix(transformation, itemTrans);
+                                modelRenderer->render();
                             }
                         }
                     }
@@ -406,23 +427,25 @@ namespace TrenchBroom {
                         kdl::vec_append(stringVertices[defaultDescriptor], titleVertices);
                     }
 
-                    for (size_t j = 0; j < group.size(); ++j) {
+                    for (size_t j = group.indexOfRowAt(y); j < group.size(); ++j) {
                         const auto& row = group[j];
-                        if (row.intersectsY(y, height)) {
-                            for (unsigned int k = 0; k < row.size(); k++) {
-                                const auto& cell = row[k];
-                                const auto titleBounds = cell.titleBounds();
-                                const auto offset = vm::vec2f(titleBounds.left(), height - (titleBounds.top() - y) - titleBounds.height());
-
-                                Renderer::TextureFont& font = fontManager().font(cellData(cell).fontDescriptor);
-                                const auto quads = font.quads(cellData(cell).entityDefinition->name(), false, offset);
-                                const auto titleVertices = TextVertex::toList(
-                                    quads.size() / 2,
-                                    kdl::skip_iterator(std::begin(quads), std::end(quads), 0, 2),
-                                    kdl::skip_iterator(std::begin(quads), std::end(quads), 1, 2),
-                                    kdl::skip_iterator(std::begin(textColor), std::end(textColor), 0, 0));
-                                kdl::vec_append(stringVertices[cellData(cell).fontDescriptor], titleVertices);
-                            }
+                        if (!row.intersectsY(y, height)) {
+                            break;
+                        }
+
+                        for (unsigned int k = 0; k < row.size(); k++) {
+                            const auto& cell = row[k];
+                            const auto titleBounds = cell.titleBounds();
+                            const auto offset = vm::vec2f(titleBounds.left(), height - (titleBounds.top() - y) - titleBounds.height());
+
+                            Renderer::TextureFont& font = fontManager().font(cellData(cell).fontDescriptor);
+                            const auto quads = font.quads(cellData(cell).entityDefinition->name(), false, offset);
+                            const auto titleVertices = TextVertex::toList(
+                                quads.size() / 2,
+                                kdl::skip_iterator(std::begin(quads), std::end(quads), 0, 2),
+                                kdl::skip_iterator(std::begin(quads), std::end(quads), 1, 2),
+                                kdl::skip_iterator(std::begin(textColor), std::end(textColor), 0, 0));
+                            kdl::vec_append(stringVertices[cellData(cell).fontDescriptor], titleVertices);
                         }
                     }
                 }
@@ -27,8 +27,11 @@
 #include <vecmath/forward.h>
 #include <vecmath/quat.h>
 #include <vecmath/bbox.h>
+#include <vecmath/vec.h>
 
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace TrenchBroom {
@@ -79,6 +82,20 @@ namespace TrenchBroom {
             bool m_hideUnused;
             Assets::EntityDefinitionSortOrder m_sortOrder;
             std::string m_filterText;
+
+            /**
+             * The font and size of an entity definition's name in the layout. Measuring the names is expensive, so
+             * these are cached across reloads. The name is kept to detect that a cached definition was replaced by
+             * another one at the same address.
+             */
+            struct CachedTitle {
+                std::string name;
+                Renderer::FontDescriptor font;
+                vm::vec2f size;
+            };
+
+            std::unordered_map<const Assets::PointEntityDefinition*, CachedTitle> m_titleCache;
+            std::optional<Renderer::FontDescriptor> m_titleCacheFont;
         public:
             EntityBrowserView(QScrollBar* scrollBar,
                               GLContextManager& contextManager,
@@ -101,6 +118,7 @@ namespace TrenchBroom {
             QString dndData(const Cell& cell) override;
 
             void addEntityToLayout(Layout& layout, const Assets::PointEntityDefinition* definition, const Renderer::FontDescriptor& font);
+            const CachedTitle& cachedTitle(const Layout& layout, const Assets::PointEntityDefinition* definition, const Renderer::FontDescriptor& font);
 
             void doClear() override;
             void doRender(Layout& layout, float y, float height) override;
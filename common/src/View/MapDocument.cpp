@@ -19,26 +19,29 @@
 
 #include "View/MapDocument.h"
 
+#include "InternedString.h"
 #include "PreferenceManager.h"
 #include "Preferences.h"
 #include "Assets/EntityDefinition.h"
 #include "Assets/EntityDefinitionGroup.h"
 #include "Assets/EntityDefinitionManager.h"
 #include "Assets/EntityModelManager.h"
+#include "Assets/ModelDefinition.h"
 #include "Assets/Texture.h"
 #include "Assets/TextureManager.h"
 #include "IO/DiskFileSystem.h"
 #include "IO/DiskIO.h"
 #include "IO/SimpleParserStatus.h"
 #include "IO/SystemPaths.h"
+#include "Model/AssortNodesVisitor.h"
 #include "Model/AttributeNameWithDoubleQuotationMarksIssueGenerator.h"
 #include "Model/AttributeValueWithDoubleQuotationMarksIssueGenerator.h"
 #include "Model/Brush.h"
 #include "Model/BrushBuilder.h"
+#include "Model/BrushFace.h"
 #include "Model/BrushGeometry.h"
 #include "Model/ChangeBrushFaceAttributesRequest.h"
 #include "Model/CollectAttributableNodesVisitor.h"
-#include "Model/CollectContainedNodesVisitor.h"
 #include "Model/CollectMatchingBrushFacesVisitor.h"
 #include "Model/CollectNodesVisitor.h"
 #include "Model/CollectSelectableNodesVisitor.h"
@@ -53,11 +56,13 @@
 #include "Model/EmptyBrushEntityIssueGenerator.h"
 #include "Model/EmptyGroupIssueGenerator.h"
 #include "Model/Entity.h"
+#include "Model/FindGroupVisitor.h"
 #include "Model/LinkSourceIssueGenerator.h"
 #include "Model/LinkTargetIssueGenerator.h"
 #include "Model/Game.h"
 #include "Model/GameFactory.h"
 #include "Model/Group.h"
+#include "Model/Hit.h"
 #include "Model/InvalidTextureScaleIssueGenerator.h"
 #include "Model/LongAttributeNameIssueGenerator.h"
 #include "Model/LongAttributeValueIssueGenerator.h"
@@ -118,6 +123,7 @@
 #include <kdl/collection_utils.h>
 #include <kdl/map_utils.h>
 #include <kdl/memory_utils.h>
+#include <kdl/vector_set.h>
 #include <kdl/vector_utils.h>
 
 #include <vecmath/polygon.h>
@@ -130,6 +136,8 @@
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace TrenchBroom {
@@ -290,6 +298,10 @@ namespace TrenchBroom {
             loadWorld(mapFormat, worldBounds, game, path);
 
             loadAssets();
+
+            const auto strings = InternedString::statistics();
+            debug() << "Interned " << strings.internedStrings << " strings (" << strings.internedBytes << " bytes) as "
+                    << strings.distinctStrings << " distinct strings (" << strings.storedBytes << " bytes)";
             registerIssueGenerators();
             registerSmartTags();
             createTagActions();
@@ -586,12 +598,7 @@ namespace TrenchBroom {
         }
 
         void MapDocument::selectInside(const bool del) {
-            const std::vector<Model::Brush*>& brushes = m_selectedNodes.brushes();
-
-            Model::CollectContainedNodesVisitor<std::vector<Model::Brush*>::const_iterator> visitor(std::begin(brushes), std::end(brushes), editorContext());
-            m_world->acceptAndRecurse(visitor);
-
-            const std::vector<Model::Node*> nodes = visitor.nodes();
+            const std::vector<Model::Node*> nodes = findSelectableNodesInside(m_selectedNodes.brushes());
 
             Transaction transaction(this, "Select Inside");
             if (del)
@@ -1172,11 +1179,31 @@ namespace TrenchBroom {
                 return false;
             }
 
-            Transaction transaction(this, "CSG Subtract");
-            // Select touching, but don't delete the subtrahends yet
-            selectTouching(false);
+            // Find the brushes touching the subtrahends, using the node tree to skip all brushes whose bounds don't
+            // intersect with a subtrahend. Each minuend is only subtracted by the subtrahends which touch it.
+            std::vector<Model::Brush*> minuends;
+            std::vector<std::vector<Model::Brush*>> touchingSubtrahends;
+            std::unordered_map<Model::Brush*, size_t> minuendIndices;
 
-            const auto minuends = std::vector<Model::Brush*>{selectedNodes().brushes()};
+            for (auto* subtrahend : subtrahends) {
+                const auto candidates = m_world->findNodesIntersecting(subtrahend->logicalBounds());
+
+                Model::CollectBrushesVisitor collect;
+                Model::Node::accept(std::begin(candidates), std::end(candidates), collect);
+
+                for (auto* brush : collect.brushes()) {
+                    if (!brush->selected() && editorContext().selectable(brush) && subtrahend->intersects(brush)) {
+                        const auto [it, inserted] = minuendIndices.emplace(brush, minuends.size());
+                        if (inserted) {
+                            minuends.push_back(brush);
+                            touchingSubtrahends.emplace_back();
+                        }
+                        touchingSubtrahends[it->second].push_back(subtrahend);
+                    }
+                }
+            }
+
+            const auto results = Model::Brush::subtractAll(*m_world, m_worldBounds, currentTextureName(), minuends, touchingSubtrahends);
 
             std::map<Model::Node*, std::vector<Model::Node*>> toAdd;
             std::vector<Model::Node*> toRemove;
@@ -1185,15 +1212,15 @@ namespace TrenchBroom {
                 toRemove.push_back(subtrahend);
             }
 
-            for (auto* minuend : minuends) {
-                const std::vector<Model::Brush*> result = minuend->subtract(*m_world, m_worldBounds, currentTextureName(), subtrahends);
-
-                if (!result.empty()) {
-                    kdl::vec_append(toAdd[minuend->parent()], result);
+            for (size_t i = 0u; i < minuends.size(); ++i) {
+                auto* minuend = minuends[i];
+                if (!results[i].empty()) {
+                    kdl::vec_append(toAdd[minuend->parent()], results[i]);
                 }
                 toRemove.push_back(minuend);
             }
 
+            Transaction transaction(this, "CSG Subtract");
             deselectAll();
             const std::vector<Model::Node*> added = addNodes(toAdd);
             removeNodes(toRemove);
@@ -1578,6 +1605,13 @@ namespace TrenchBroom {
                 m_world->pick(pickRay, pickResult);
         }
 
+        Model::Hit MapDocument::pickClosest(const vm::ray3& pickRay, const Model::HitFilter& filter) const {
+            if (m_world != nullptr) {
+                return m_world->pickClosest(pickRay, *m_editorContext, filter);
+            }
+            return Model::Hit::NoHit;
+        }
+
         std::vector<Model::Node*> MapDocument::findNodesContaining(const vm::vec3& point) const {
             std::vector<Model::Node*> result;
             if (m_world != nullptr) {
@@ -1586,6 +1620,37 @@ namespace TrenchBroom {
             return result;
         }
 
+        std::vector<Model::Node*> MapDocument::findSelectableNodesInside(const std::vector<Model::Brush*>& brushes) const {
+            std::vector<Model::Node*> result;
+            if (m_world == nullptr) {
+                return result;
+            }
+
+            std::unordered_set<Model::Node*> found;
+            for (const auto* brush : brushes) {
+                const auto planes = kdl::vec_transform(brush->faces(), [](const auto* face) { return face->boundary(); });
+
+                // a node that is contained in the brush intersects it, so the query finds every candidate
+                for (auto* node : m_world->findNodesIntersecting(planes)) {
+                    // the children of closed groups can only be selected together with their group
+                    auto* selectable = node;
+                    if (!m_editorContext->selectable(selectable)) {
+                        selectable = Model::findOutermostClosedGroup(node);
+                        if (selectable == nullptr || !m_editorContext->selectable(selectable)) {
+                            continue;
+                        }
+                    }
+
+                    if (selectable != brush && found.count(selectable) == 0 && brush->contains(selectable)) {
+                        found.insert(selectable);
+                        result.push_back(selectable);
+                    }
+                }
+            }
+
+            return result;
+        }
+
         void MapDocument::createWorld(const Model::MapFormat mapFormat, const vm::bbox3& worldBounds, std::shared_ptr<Model::Game> game) {
             m_worldBounds = worldBounds;
             m_game = game;
@@ -1659,6 +1724,15 @@ namespace TrenchBroom {
             setEntityDefinitionFile(oldSpec);
         }
 
+        void MapDocument::processLoadedEntityModels() {
+            const auto loadedPaths = m_entityModelManager->processLoadedModels();
+            if (!loadedPaths.empty()) {
+                SetLoadedEntityModels visitor(*m_entityModelManager, loadedPaths);
+                m_world->acceptAndRecurse(visitor);
+                entityModelsWereLoadedNotifier(loadedPaths, visitor.entities());
+            }
+        }
+
         void MapDocument::loadAssets() {
             loadEntityDefinitions();
             setEntityDefinitions();
@@ -1709,8 +1783,12 @@ namespace TrenchBroom {
 
         void MapDocument::reloadTextures() {
             unloadTextures();
+
+            // the entity model loader reads from the game file system, which is rebuilt when the shaders are reloaded
+            m_entityModelManager->cancelPendingLoads();
             m_game->reloadShaders();
             loadTextures();
+            setEntityModels();
         }
 
         void MapDocument::loadTextures() {
@@ -1861,6 +1939,33 @@ namespace TrenchBroom {
             void doVisit(Model::Brush*) override         {}
         };
 
+        class MapDocument::SetLoadedEntityModels : public Model::NodeVisitor {
+        private:
+            Assets::EntityModelManager& m_manager;
+            kdl::vector_set<IO::Path> m_loadedPaths;
+            std::vector<Model::Entity*> m_entities;
+        public:
+            SetLoadedEntityModels(Assets::EntityModelManager& manager, const std::vector<IO::Path>& loadedPaths) :
+            m_manager(manager),
+            m_loadedPaths(std::begin(loadedPaths), std::end(loadedPaths)) {}
+
+            const std::vector<Model::Entity*>& entities() const {
+                return m_entities;
+            }
+        private:
+            void doVisit(Model::World*) override         {}
+            void doVisit(Model::Layer*) override         {}
+            void doVisit(Model::Group*) override         {}
+            void doVisit(Model::Entity* entity) override {
+                const auto spec = entity->modelSpecification();
+                if (m_loadedPaths.count(spec.path) > 0) {
+                    entity->setModelFrame(m_manager.frame(spec));
+                    m_entities.push_back(entity);
+                }
+            }
+            void doVisit(Model::Brush*) override         {}
+        };
+
         class MapDocument::UnsetEntityModels : public Model::NodeVisitor {
         private:
             void doVisit(Model::World*) override         {}
@@ -1907,6 +2012,7 @@ namespace TrenchBroom {
 
         void MapDocument::updateGameSearchPaths() {
             const std::vector<IO::Path> additionalSearchPaths = IO::Path::asPaths(mods());
+            m_entityModelManager->cancelPendingLoads();
             m_game->setAdditionalSearchPaths(additionalSearchPaths, logger());
         }
 
@@ -2031,9 +2137,13 @@ namespace TrenchBroom {
             }
         }
 
-        void MapDocument::updateFaceTags(const std::vector<Model::BrushFace*>& faces) {
+        void MapDocument::updateFaceTags(const std::vector<Model::BrushFace*>& faces, const Model::TagDependency::Type dependencies) {
+            if (dependencies == Model::TagDependency::None) {
+                return;
+            }
+
             for (auto* face : faces) {
-                face->updateTags(*m_tagManager);
+                face->updateTags(*m_tagManager, dependencies);
             }
         }
 
@@ -2108,7 +2218,6 @@ namespace TrenchBroom {
             nodesWereAddedNotifier.addObserver(this, &MapDocument::initializeNodeTags);
             nodesWillBeRemovedNotifier.addObserver(this, &MapDocument::clearNodeTags);
             nodesDidChangeNotifier.addObserver(this, &MapDocument::updateNodeTags);
-            brushFacesDidChangeNotifier.addObserver(this, &MapDocument::updateFaceTags);
             modsDidChangeNotifier.addObserver(this, &MapDocument::updateAllFaceTags);
             textureCollectionsDidChangeNotifier.addObserver(this, &MapDocument::updateAllFaceTags);
         }
@@ -2127,7 +2236,6 @@ namespace TrenchBroom {
             nodesWereAddedNotifier.removeObserver(this, &MapDocument::initializeNodeTags);
             nodesWillBeRemovedNotifier.removeObserver(this, &MapDocument::clearNodeTags);
             nodesDidChangeNotifier.removeObserver(this, &MapDocument::updateNodeTags);
-            brushFacesDidChangeNotifier.removeObserver(this, &MapDocument::updateFaceTags);
             modsDidChangeNotifier.removeObserver(this, &MapDocument::updateAllFaceTags);
             textureCollectionsDidChangeNotifier.removeObserver(this, &MapDocument::updateAllFaceTags);
         }
@@ -2136,10 +2244,9 @@ namespace TrenchBroom {
             if (isGamePathPreference(path)) {
                 const Model::GameFactory& gameFactory = Model::GameFactory::instance();
                 const IO::Path newGamePath = gameFactory.gamePath(m_game->gameName());
-                m_game->setGamePath(newGamePath, logger());
 
                 clearEntityModels();
-                setEntityModels();
+                m_game->setGamePath(newGamePath, logger());
 
                 reloadTextures();
                 setTextures();
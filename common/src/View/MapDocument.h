@@ -25,6 +25,7 @@
 #include "IO/Path.h"
 #include "Model/MapFacade.h"
 #include "Model/NodeCollection.h"
+#include "Model/TagType.h"
 #include "View/CachingLogger.h"
 
 #include <vecmath/forward.h>
@@ -51,8 +52,11 @@ namespace TrenchBroom {
     namespace Model {
         class BrushFaceAttributes;
         class EditorContext;
+        class Entity;
         enum class ExportFormat;
         class Game;
+        class Hit;
+        class HitFilter;
         class Issue;
         enum class MapFormat;
         class PickResult;
@@ -161,6 +165,7 @@ namespace TrenchBroom {
             Notifier<> textureCollectionsDidChangeNotifier;
 
             Notifier<> entityDefinitionsDidChangeNotifier;
+            Notifier<const std::vector<IO::Path>&, const std::vector<Model::Entity*>&> entityModelsWereLoadedNotifier;
             Notifier<> modsDidChangeNotifier;
 
             Notifier<> pointFileWasLoadedNotifier;
@@ -434,7 +439,14 @@ namespace TrenchBroom {
             void commitPendingAssets();
         public: // picking
             void pick(const vm::ray3& pickRay, Model::PickResult& pickResult) const;
+            Model::Hit pickClosest(const vm::ray3& pickRay, const Model::HitFilter& filter) const;
             std::vector<Model::Node*> findNodesContaining(const vm::vec3& point) const;
+            /**
+             * Returns the selectable nodes that are contained in any of the given brushes. Nodes in closed groups are
+             * represented by their outermost closed group, which is returned if the group is contained. The given
+             * brushes need not belong to the map.
+             */
+            std::vector<Model::Node*> findSelectableNodesInside(const std::vector<Model::Brush*>& brushes) const;
         private: // world management
             void createWorld(Model::MapFormat mapFormat, const vm::bbox3& worldBounds, std::shared_ptr<Model::Game> game);
             void loadWorld(Model::MapFormat mapFormat, const vm::bbox3& worldBounds, std::shared_ptr<Model::Game> game, const IO::Path& path);
@@ -453,6 +465,12 @@ namespace TrenchBroom {
             void reloadTextureCollections();
 
             void reloadEntityDefinitions();
+
+            /**
+             * Assigns the entity models that have finished loading in the background to the entities that use them.
+             * Must be called periodically on the main thread.
+             */
+            void processLoadedEntityModels();
         private:
             void loadAssets();
             void unloadAssets();
@@ -486,6 +504,7 @@ namespace TrenchBroom {
             void clearEntityModels();
 
             class SetEntityModels;
+            class SetLoadedEntityModels;
             class UnsetEntityModels;
             void setEntityModels();
             void setEntityModels(const std::vector<Model::Node*>& nodes);
@@ -520,8 +539,13 @@ namespace TrenchBroom {
             void updateNodeTags(const std::vector<Model::Node*>& nodes);
 
             class InitializeFaceTagsVisitor;
-            void updateFaceTags(const std::vector<Model::BrushFace*>& faces);
             void updateAllFaceTags();
+        protected:
+            /**
+             * Updates the tags of the given faces whose matchers depend on any of the given properties. Called before
+             * brushFacesDidChangeNotifier is fired so that texture coordinate changes do not re-evaluate any tags.
+             */
+            void updateFaceTags(const std::vector<Model::BrushFace*>& faces, Model::TagDependency::Type dependencies);
         public: // document path
             bool persistent() const;
             std::string filename() const;
@@ -729,6 +729,7 @@ namespace TrenchBroom {
             const auto& faces = allSelectedBrushFaces();
             if (request.evaluate(faces)) {
                 setTextures(faces);
+                updateFaceTags(faces, request.tagDependencies());
                 brushFacesDidChangeNotifier(faces);
             }
         }
@@ -908,6 +909,7 @@ namespace TrenchBroom {
             if (!brushFaces.empty()) {
                 snapshot->restoreBrushFaces();
                 setTextures(brushFaces);
+                updateFaceTags(brushFaces, Model::TagDependency::All);
                 brushFacesDidChangeNotifier(brushFaces);
             }
         }
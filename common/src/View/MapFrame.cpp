@@ -97,6 +97,7 @@ namespace TrenchBroom {
         m_document(std::move(document)),
         m_autosaver(std::make_unique<Autosaver>(m_document)),
         m_autosaveTimer(nullptr),
+        m_entityModelTimer(nullptr),
         m_toolBar(nullptr),
         m_hSplitter(nullptr),
         m_vSplitter(nullptr),
@@ -136,6 +137,10 @@ namespace TrenchBroom {
             m_autosaveTimer = new QTimer(this);
             m_autosaveTimer->start(1000);
 
+            // entity models are loaded in the background and must be picked up on the main thread
+            m_entityModelTimer = new QTimer(this);
+            m_entityModelTimer->start(50);
+
             bindObservers();
             bindEvents();
 
@@ -659,6 +664,7 @@ namespace TrenchBroom {
 
         void MapFrame::bindEvents() {
             connect(m_autosaveTimer, &QTimer::timeout, this, &MapFrame::triggerAutosave);
+            connect(m_entityModelTimer, &QTimer::timeout, this, &MapFrame::processLoadedEntityModels);
             connect(qApp, &QApplication::focusChanged, this, &MapFrame::focusChange);
             connect(m_gridChoice, QOverload<int>::of(&QComboBox::activated), this, [this](const int index) { setGridSize(index + Grid::MinSize); });
             connect(QApplication::clipboard(), &QClipboard::dataChanged, this, &MapFrame::updatePasteActions);
@@ -1628,5 +1634,9 @@ namespace TrenchBroom {
         void MapFrame::triggerAutosave() {
             m_autosaver->triggerAutosave(logger());
         }
+
+        void MapFrame::processLoadedEntityModels() {
+            m_document->processLoadedEntityModels();
+        }
     }
 }
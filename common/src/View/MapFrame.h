@@ -77,6 +77,7 @@ namespace TrenchBroom {
 
             std::unique_ptr<Autosaver> m_autosaver;
             QTimer* m_autosaveTimer;
+            QTimer* m_entityModelTimer;
 
             QToolBar* m_toolBar;
 
@@ -355,6 +356,7 @@ namespace TrenchBroom {
             void closeEvent(QCloseEvent* event) override;
         private:
             void triggerAutosave();
+            void processLoadedEntityModels();
         };
     }
 }
@@ -24,7 +24,6 @@
 #include "Assets/EntityDefinitionManager.h"
 #include "Model/Brush.h"
 #include "Model/BrushBuilder.h"
-#include "Model/CollectContainedNodesVisitor.h"
 #include "Model/HitAdapter.h"
 #include "Model/PickResult.h"
 #include "Model/PointFile.h"
@@ -220,9 +219,7 @@ namespace TrenchBroom {
             Transaction transaction(document, "Select Tall");
             document->deleteObjects();
 
-            Model::CollectContainedNodesVisitor<std::vector<Model::Brush*>::const_iterator> visitor(std::begin(tallBrushes), std::end(tallBrushes), document->editorContext());
-            document->world()->acceptAndRecurse(visitor);
-            document->select(visitor.nodes());
+            document->select(document->findSelectableNodesInside(tallBrushes));
 
             kdl::vec_clear_and_delete(tallBrushes);
         }
@@ -28,6 +28,7 @@
 #include "Model/BrushGeometry.h"
 #include "Model/Entity.h"
 #include "Model/HitAdapter.h"
+#include "Model/HitFilter.h"
 #include "Model/HitQuery.h"
 #include "Model/PickResult.h"
 #include "Model/PointFile.h"
@@ -209,11 +210,10 @@ namespace TrenchBroom {
             if (QRect(0, 0, width(), height()).contains(clientCoords)) {
                 const auto pickRay = vm::ray3(m_camera->pickRay(clientCoords.x(), clientCoords.y()));
 
-                const auto& editorContext = document->editorContext();
-                auto pickResult = Model::PickResult::byDistance(editorContext);
-
-                document->pick(pickRay, pickResult);
-                const auto& hit = pickResult.query().pickable().type(Model::Brush::BrushHit).occluded().first();
+                const auto filter = Model::HitFilterChain(
+                    std::make_unique<Model::ContextHitFilter>(document->editorContext()),
+                    std::make_unique<Model::TypedHitFilter>(Model::Brush::BrushHit));
+                const auto hit = document->pickClosest(pickRay, filter);
 
                 if (hit.isMatch()) {
                     const auto* face = Model::hitToFace(hit);
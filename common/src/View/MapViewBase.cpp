@@ -47,7 +47,8 @@
 #include "Renderer/FontDescriptor.h"
 #include "Renderer/FontManager.h"
 #include "Renderer/MapRenderer.h"
-#include "Renderer/PrimitiveRenderer.h"
+#include "Renderer/PortalFileMesh.h"
+#include "Renderer/PortalFileRenderer.h"
 #include "Renderer/RenderBatch.h"
 #include "Renderer/RenderContext.h"
 #include "Renderer/RenderService.h"
@@ -72,6 +73,7 @@
 #include <vecmath/polygon.h>
 #include <vecmath/util.h>
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -130,6 +132,7 @@ namespace TrenchBroom {
             document->selectionDidChangeNotifier.addObserver(this, &MapViewBase::selectionDidChange);
             document->textureCollectionsDidChangeNotifier.addObserver(this, &MapViewBase::textureCollectionsDidChange);
             document->entityDefinitionsDidChangeNotifier.addObserver(this, &MapViewBase::entityDefinitionsDidChange);
+            document->entityModelsWereLoadedNotifier.addObserver(this, &MapViewBase::entityModelsWereLoaded);
             document->modsDidChangeNotifier.addObserver(this, &MapViewBase::modsDidChange);
             document->editorContextDidChangeNotifier.addObserver(this, &MapViewBase::editorContextDidChange);
             document->mapViewConfigDidChangeNotifier.addObserver(this, &MapViewBase::mapViewConfigDidChange);
@@ -164,6 +167,7 @@ namespace TrenchBroom {
                 document->selectionDidChangeNotifier.removeObserver(this, &MapViewBase::selectionDidChange);
                 document->textureCollectionsDidChangeNotifier.removeObserver(this, &MapViewBase::textureCollectionsDidChange);
                 document->entityDefinitionsDidChangeNotifier.removeObserver(this, &MapViewBase::entityDefinitionsDidChange);
+                document->entityModelsWereLoadedNotifier.removeObserver(this, &MapViewBase::entityModelsWereLoaded);
                 document->modsDidChangeNotifier.removeObserver(this, &MapViewBase::modsDidChange);
                 document->editorContextDidChangeNotifier.removeObserver(this, &MapViewBase::editorContextDidChange);
                 document->mapViewConfigDidChangeNotifier.removeObserver(this, &MapViewBase::mapViewConfigDidChange);
@@ -223,6 +227,13 @@ namespace TrenchBroom {
             update();
         }
 
+        void MapViewBase::entityModelsWereLoaded(const std::vector<IO::Path>& /* paths */, const std::vector<Model::Entity*>& entities) {
+            if (!entities.empty()) {
+                updatePickResult();
+                update();
+            }
+        }
+
         void MapViewBase::modsDidChange() {
             update();
         }
@@ -253,6 +264,10 @@ namespace TrenchBroom {
                 fontManager().clearCache();
             }
 
+            if (path == Preferences::PortalFileMaxPortals.path()) {
+                invalidatePortalFileRenderer();
+            }
+
             updateActionBindings();
             update();
         }
@@ -930,24 +945,18 @@ namespace TrenchBroom {
 
         void MapViewBase::validatePortalFileRenderer(Renderer::RenderContext&) {
             assert(m_portalFileRenderer == nullptr);
-            m_portalFileRenderer = std::make_unique<Renderer::PrimitiveRenderer>();
 
             auto document = kdl::mem_lock(m_document);
             Model::PortalFile* portalFile = document->portalFile();
-            if (portalFile != nullptr) {
-                for (const auto& poly : portalFile->portals()) {
-                    m_portalFileRenderer->renderFilledPolygon(pref(Preferences::PortalFileFillColor),
-                                                              Renderer::PrimitiveRendererOcclusionPolicy::Hide,
-                                                              Renderer::PrimitiveRendererCullingPolicy::ShowBackfaces,
-                                                              poly.vertices());
-
-                    const auto lineWidth = 4.0f;
-                    m_portalFileRenderer->renderPolygon(pref(Preferences::PortalFileBorderColor),
-                                                        lineWidth,
-                                                        Renderer::PrimitiveRendererOcclusionPolicy::Hide,
-                                                        poly.vertices());
-                }
-            }
+            auto mesh = portalFile != nullptr ? Renderer::PortalFileMesh(portalFile->portals()) : Renderer::PortalFileMesh(std::vector<vm::polygon3f>());
+
+            const auto lineWidth = 4.0f;
+            const auto maxPortals = static_cast<size_t>(std::max(pref(Preferences::PortalFileMaxPortals), 0));
+            m_portalFileRenderer = std::make_unique<Renderer::PortalFileRenderer>(std::move(mesh),
+                                                                                  pref(Preferences::PortalFileFillColor),
+                                                                                  pref(Preferences::PortalFileBorderColor),
+                                                                                  lineWidth,
+                                                                                  maxPortals);
         }
 
         void MapViewBase::renderCompass(Renderer::RenderBatch& renderBatch) {
@@ -50,6 +50,7 @@ namespace TrenchBroom {
     }
 
     namespace Model {
+        class Entity;
         class Group;
         class Node;
         class NodeCollection;
@@ -60,7 +61,7 @@ namespace TrenchBroom {
         class Camera;
         class Compass;
         class MapRenderer;
-        class PrimitiveRenderer;
+        class PortalFileRenderer;
         class RenderBatch;
         class RenderContext;
         enum class RenderMode;
@@ -89,7 +90,7 @@ namespace TrenchBroom {
         private:
             Renderer::MapRenderer& m_renderer;
             std::unique_ptr<Renderer::Compass> m_compass;
-            std::unique_ptr<Renderer::PrimitiveRenderer> m_portalFileRenderer;
+            std::unique_ptr<Renderer::PortalFileRenderer> m_portalFileRenderer;
 
             /**
              * Tracks whether this map view has most recently gotten the focus. This is tracked and updated by a
@@ -117,6 +118,7 @@ namespace TrenchBroom {
             void selectionDidChange(const Selection& selection);
             void textureCollectionsDidChange();
             void entityDefinitionsDidChange();
+            void entityModelsWereLoaded(const std::vector<IO::Path>& paths, const std::vector<Model::Entity*>& entities);
             void modsDidChange();
             void editorContextDidChange();
             void mapViewConfigDidChange();
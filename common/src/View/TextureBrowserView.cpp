@@ -45,6 +45,7 @@
 #include <vecmath/mat_ext.h>
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <QTextStream>
@@ -63,7 +64,9 @@ namespace TrenchBroom {
         m_group(false),
         m_hideUnused(false),
         m_sortOrder(TextureSortOrder::Name),
-        m_selectedTexture(nullptr) {
+        m_selectedTexture(nullptr),
+        m_cellCacheIconSize(0.0f),
+        m_cellCacheMaxCellWidth(0.0f) {
             auto doc = kdl::mem_lock(m_document);
             doc->textureManager().usageCountDidChange.addObserver(this, &TextureBrowserView::usageCountDidChange);
         }
@@ -147,6 +150,7 @@ namespace TrenchBroom {
             assert(fontSize > 0);
 
             const Renderer::FontDescriptor font(fontPath, static_cast<size_t>(fontSize));
+            validateCellCache(layout, font);
 
             if (m_group) {
                 for (const Assets::TextureCollection* collection : getCollections()) {
@@ -161,10 +165,44 @@ namespace TrenchBroom {
         }
 
         void TextureBrowserView::addTextureToLayout(Layout& layout, Assets::Texture* texture, const Renderer::FontDescriptor& font) {
+            const auto& cell = cachedCell(layout, texture, font);
+            layout.addItem(QVariant::fromValue(cell.cellData),
+            cell.itemWidth,
+            cell.itemHeight,
+            cell.titleWidth,
+            cell.titleHeight);
+        }
+
+        void TextureBrowserView::validateCellCache(const Layout& layout, const Renderer::FontDescriptor& font) {
+            const float scaleFactor = pref(Preferences::TextureBrowserIconSize);
+            if (!m_cellCacheFont ||
+                m_cellCacheFont->compare(font) != 0 ||
+                m_cellCacheIconSize != scaleFactor ||
+                m_cellCacheMaxCellWidth != layout.maxCellWidth()) {
+                m_cellCache.clear();
+                m_cellCacheFont = font;
+                m_cellCacheIconSize = scaleFactor;
+                m_cellCacheMaxCellWidth = layout.maxCellWidth();
+            }
+        }
+
+        const TextureBrowserView::CachedCell& TextureBrowserView::cachedCell(const Layout& layout, Assets::Texture* texture, const Renderer::FontDescriptor& font) {
+            const auto& groupName = texture->collection()->name();
+
+            auto it = m_cellCache.find(texture);
+            if (it != std::end(m_cellCache)) {
+                const auto& cell = it->second;
+                if (cell.textureName == texture->name() &&
+                    cell.collectionName == groupName &&
+                    cell.textureWidth == texture->width() &&
+                    cell.textureHeight == texture->height()) {
+                    return cell;
+                }
+            }
+
             const float maxCellWidth = layout.maxCellWidth();
 
-            const auto& groupName   = texture->collection()->name();
-            const auto  textureName = IO::Path(texture->name()).lastComponent().asString();
+            const auto textureName = IO::Path(texture->name()).lastComponent().asString();
 
             const auto textureFont = fontManager().selectFontSize(font, textureName, maxCellWidth, 6);
             const auto groupFont   = fontManager().selectFontSize(font, groupName, maxCellWidth, 6);
@@ -189,11 +227,19 @@ namespace TrenchBroom {
                 groupFont
             });
 
-            layout.addItem(QVariant::fromValue(cellData),
-            scaledTextureWidth,
-            scaledTextureHeight,
-            maxCellWidth,
-            totalSize.y());
+            auto& cell = m_cellCache[texture];
+            cell = CachedCell{
+                texture->name(),
+                groupName,
+                texture->width(),
+                texture->height(),
+                std::move(cellData),
+                scaledTextureWidth,
+                scaledTextureHeight,
+                maxCellWidth,
+                totalSize.y()
+            };
+            return cell;
         }
 
         struct TextureBrowserView::CompareByUsageCount {
@@ -227,12 +273,12 @@ namespace TrenchBroom {
         };
 
         struct TextureBrowserView::MatchName {
-            std::string pattern;
+            std::unordered_set<const Assets::Texture*> matches;
 
-            explicit MatchName(const std::string& i_pattern) : pattern(i_pattern) {}
+            explicit MatchName(const std::vector<Assets::Texture*>& i_matches) : matches(std::begin(i_matches), std::end(i_matches)) {}
 
             bool operator()(const Assets::Texture* texture) const {
-                return !kdl::ci::str_contains(texture->name(), pattern);
+                return matches.count(texture) == 0u;
             }
         };
 
@@ -266,8 +312,10 @@ namespace TrenchBroom {
         void TextureBrowserView::filterTextures(std::vector<Assets::Texture*>& textures) const {
             if (m_hideUnused)
                 kdl::vec_erase_if(textures, MatchUsageCount());
-            if (!m_filterText.empty())
-                kdl::vec_erase_if(textures, MatchName(m_filterText));
+            if (!m_filterText.empty()) {
+                auto doc = kdl::mem_lock(m_document);
+                kdl::vec_erase_if(textures, MatchName(doc->textureManager().findTexturesContaining(m_filterText)));
+            }
         }
 
         void TextureBrowserView::sortTextures(std::vector<Assets::Texture*>& textures) const {
@@ -281,7 +329,9 @@ namespace TrenchBroom {
             }
         }
 
-        void TextureBrowserView::doClear() {}
+        void TextureBrowserView::doClear() {
+            m_cellCache.clear();
+        }
 
         void TextureBrowserView::doRender(Layout& layout, const float y, const float height) {
             auto doc = kdl::mem_lock(m_document);
@@ -315,19 +365,21 @@ namespace TrenchBroom {
             for (size_t i = 0; i < layout.size(); ++i) {
                 const Group& group = layout[i];
                 if (group.intersectsY(y, height)) {
-                    for (size_t j = 0; j < group.size(); ++j) {
+                    for (size_t j = group.indexOfRowAt(y); j < group.size(); ++j) {
                         const Row& row = group[j];
-                        if (row.intersectsY(y, height)) {
-                            for (size_t k = 0; k < row.size(); ++k) {
-                                const Cell& cell = row[k];
-                                const LayoutBounds& bounds = cell.itemBounds();
-                                const Assets::Texture* texture = cellData(cell).texture;
-                                const Color& color = textureColor(*texture);
-                                vertices.emplace_back(vm::vec2f(bounds.left() - 2.0f, height - (bounds.top() - 2.0f - y)), color);
-                                vertices.emplace_back(vm::vec2f(bounds.left() - 2.0f, height - (bounds.bottom() + 2.0f - y)), color);
-                                vertices.emplace_back(vm::vec2f(bounds.right() + 2.0f, height - (bounds.bottom() + 2.0f - y)), color);
-                                vertices.emplace_back(vm::vec2f(bounds.right() + 2.0f, height - (bounds.top() - 2.0f - y)), color);
-                            }
+                        if (!row.intersectsY(y, height)) {
+                            break;
+                        }
+
+                        for (size_t k = 0; k < row.size(); ++k) {
+                            const Cell& cell = row[k];
+                            const LayoutBounds& bounds = cell.itemBounds();
+                            const Assets::Texture* texture = cellData(cell).texture;
+                            const Color& color = textureColor(*texture);
+                            vertices.emplace_back(vm::vec2f(bounds.left() - 2.0f, height - (bounds.top() - 2.0f - y)), color);
+                            vertices.emplace_back(vm::vec2f(bounds.left() - 2.0f, height - (bounds.bottom() + 2.0f - y)), color);
+                            vertices.emplace_back(vm::vec2f(bounds.right() + 2.0f, height - (bounds.bottom() + 2.0f - y)), color);
+                            vertices.emplace_back(vm::vec2f(bounds.right() + 2.0f, height - (bounds.top() - 2.0f - y)), color);
                         }
                     }
                 }
@@ -361,31 +413,33 @@ namespace TrenchBroom {
             for (size_t i = 0; i < layout.size(); ++i) {
                 const Group& group = layout[i];
                 if (group.intersectsY(y, height)) {
-                    for (size_t j = 0; j < group.size(); ++j) {
+                    for (size_t j = group.indexOfRowAt(y); j < group.size(); ++j) {
                         const Row& row = group[j];
-                        if (row.intersectsY(y, height)) {
-                            for (size_t k = 0; k < row.size(); ++k) {
-                                const Cell& cell = row[k];
-                                const LayoutBounds& bounds = cell.itemBounds();
-                                const Assets::Texture* texture = cellData(cell).texture;
+                        if (!row.intersectsY(y, height)) {
+                            break;
+                        }
+
+                        for (size_t k = 0; k < row.size(); ++k) {
+                            const Cell& cell = row[k];
+                            const LayoutBounds& bounds = cell.itemBounds();
+                            const Assets::Texture* texture = cellData(cell).texture;
 
-                                Renderer::VertexArray vertexArray = Renderer::VertexArray::move(std::vector<TextureVertex>({
-                                    TextureVertex(vm::vec2f(bounds.left(),  height - (bounds.top() - y)),    vm::vec2f(0.0f, 0.0f)),
-                                    TextureVertex(vm::vec2f(bounds.left(),  height - (bounds.bottom() - y)), vm::vec2f(0.0f, 1.0f)),
-                                    TextureVertex(vm::vec2f(bounds.right(), height - (bounds.bottom() - y)), vm::vec2f(1.0f, 1.0f)),
-                                    TextureVertex(vm::vec2f(bounds.right(), height - (bounds.top() - y)),    vm::vec2f(1.0f, 0.0f))
-                                }));
+                            Renderer::VertexArray vertexArray = Renderer::VertexArray::move(std::vector<TextureVertex>({
+                                TextureVertex(vm::vec2f(bounds.left(),  height - (bounds.top() - y)),    vm::vec2f(0.0f, 0.0f)),
+                                TextureVertex(vm::vec2f(bounds.left(),  height - (bounds.bottom() - y)), vm::vec2f(0.0f, 1.0f)),
+                                TextureVertex(vm::vec2f(bounds.right(), height - (bounds.bottom() - y)), vm::vec2f(1.0f, 1.0f)),
+                                TextureVertex(vm::vec2f(bounds.right(), height - (bounds.top() - y)),    vm::vec2f(1.0f, 0.0f))
+                            }));
 
-                                shader.set("GrayScale", texture->overridden());
-                                texture->activate();
+                            shader.set("GrayScale", texture->overridden());
+                            texture->activate();
 
-                                vertexArray.prepare(vboManager());
-                                vertexArray.render(Renderer::PrimType::Quads);
+                            vertexArray.prepare(vboManager());
+                            vertexArray.render(Renderer::PrimType::Quads);
 
-                                texture->deactivate();
+                            texture->deactivate();
 
-                                ++num;
-                            }
+                            ++num;
                         }
                     }
                 }
@@ -473,42 +527,44 @@ namespace TrenchBroom {
                         vertices.insert(std::end(vertices), std::begin(titleVertices), std::end(titleVertices));
                     }
 
-                    for (size_t j = 0; j < group.size(); ++j) {
+                    for (size_t j = group.indexOfRowAt(y); j < group.size(); ++j) {
                         const auto& row = group[j];
-                        if (row.intersectsY(y, height)) {
-                            for (unsigned int k = 0; k < row.size(); k++) {
-                                const auto& cell = row[k];
-                                const auto titleBounds = cell.titleBounds();
-                                const auto& textureFont = fontManager().font(cellData(cell).mainTitleFont);
-                                const auto& groupFont   = fontManager().font(cellData(cell).subTitleFont);
-
-                                // y is relative to top, but OpenGL coords are relative to bottom, so invert
-                                const auto titleOffset = vm::vec2f(titleBounds.left(), y + height - titleBounds.bottom());
-
-                                const auto textureNameOffset = titleOffset + cellData(cell).mainTitleOffset;
-                                const auto groupNameOffset   = titleOffset + cellData(cell).subTitleOffset;
-
-                                const auto& textureName = cellData(cell).mainTitle;
-                                const auto& groupName   = cellData(cell).subTitle;
-
-                                const auto textureNameQuads = textureFont.quads(textureName, false, textureNameOffset);
-                                const auto groupNameQuads   = groupFont.quads(groupName, false, groupNameOffset);
-
-                                const auto textureNameVertices = TextVertex::toList(
-                                    textureNameQuads.size() / 2,
-                                    kdl::skip_iterator(std::begin(textureNameQuads), std::end(textureNameQuads), 0, 2),
-                                    kdl::skip_iterator(std::begin(textureNameQuads), std::end(textureNameQuads), 1, 2),
-                                    kdl::skip_iterator(std::begin(textColor), std::end(textColor), 0, 0));
-
-                                const auto groupNameVertices = TextVertex::toList(
-                                    groupNameQuads.size() / 2,
-                                    kdl::skip_iterator(std::begin(groupNameQuads), std::end(groupNameQuads), 0, 2),
-                                    kdl::skip_iterator(std::begin(groupNameQuads), std::end(groupNameQuads), 1, 2),
-                                    kdl::skip_iterator(std::begin(subTextColor), std::end(subTextColor), 0, 0));
-
-                                kdl::vec_append(stringVertices[cellData(cell).mainTitleFont], textureNameVertices);
-                                kdl::vec_append(stringVertices[cellData(cell).subTitleFont], groupNameVertices);
-                            }
+                        if (!row.intersectsY(y, height)) {
+                            break;
+                        }
+
+                        for (unsigned int k = 0; k < row.size(); k++) {
+                            const auto& cell = row[k];
+                            const auto titleBounds = cell.titleBounds();
+                            const auto& textureFont = fontManager().font(cellData(cell).mainTitleFont);
+                            const auto& groupFont   = fontManager().font(cellData(cell).subTitleFont);
+
+                            // y is relative to top, but OpenGL coords are relative to bottom, so invert
+                            const auto titleOffset = vm::vec2f(titleBounds.left(), y + height - titleBounds.bottom());
+
+                            const auto textureNameOffset = titleOffset + cellData(cell).mainTitleOffset;
+                            const auto groupNameOffset   = titleOffset + cellData(cell).subTitleOffset;
+
+                            const auto& textureName = cellData(cell).mainTitle;
+                            const auto& groupName   = cellData(cell).subTitle;
+
+                            const auto textureNameQuads = textureFont.quads(textureName, false, textureNameOffset);
+                            const auto groupNameQuads   = groupFont.quads(groupName, false, groupNameOffset);
+
+                            const auto textureNameVertices = TextVertex::toList(
+                                textureNameQuads.size() / 2,
+                                kdl::skip_iterator(std::begin(textureNameQuads), std::end(textureNameQuads), 0, 2),
+                                kdl::skip_iterator(std::begin(textureNameQuads), std::end(textureNameQuads), 1, 2),
+                                kdl::skip_iterator(std::begin(textColor), std::end(textColor), 0, 0));
+
+                            const auto groupNameVertices = TextVertex::toList(
+                                groupNameQuads.size() / 2,
+                                kdl::skip_iterator(std::begin(groupNameQuads), std::end(groupNameQuads), 0, 2),
+                                kdl::skip_iterator(std::begin(groupNameQuads), std::end(groupNameQuads), 1, 2),
+                                kdl::skip_iterator(std::begin(subTextColor), std::end(subTextColor), 0, 0));
+
+                            kdl::vec_append(stringVertices[cellData(cell).mainTitleFont], textureNameVertices);
+                            kdl::vec_append(stringVertices[cellData(cell).subTitleFont], groupNameVertices);
                         }
                     }
                 }
@@ -26,7 +26,9 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class QScrollBar;
@@ -70,6 +72,29 @@ namespace TrenchBroom {
             std::string m_filterText;
 
             Assets::Texture* m_selectedTexture;
+
+            /**
+             * The cell data and measurements of a texture. Measuring the texture and collection names is by far the
+             * most expensive part of reloading the layout, so these are cached across reloads. The texture name,
+             * collection name and size are kept to detect that a cached texture was replaced by another one at the
+             * same address.
+             */
+            struct CachedCell {
+                std::string textureName;
+                std::string collectionName;
+                size_t textureWidth;
+                size_t textureHeight;
+                std::shared_ptr<TextureCellData> cellData;
+                float itemWidth;
+                float itemHeight;
+                float titleWidth;
+                float titleHeight;
+            };
+
+            std::unordered_map<const Assets::Texture*, CachedCell> m_cellCache;
+            std::optional<Renderer::FontDescriptor> m_cellCacheFont;
+            float m_cellCacheIconSize;
+            float m_cellCacheMaxCellWidth;
         public:
             TextureBrowserView(QScrollBar* scrollBar,
                                GLContextManager& contextManager,
@@ -89,6 +114,8 @@ namespace TrenchBroom {
             void doInitLayout(Layout& layout) override;
             void doReloadLayout(Layout& layout) override;
             void addTextureToLayout(Layout& layout, Assets::Texture* texture, const Renderer::FontDescriptor& font);
+            void validateCellCache(const Layout& layout, const Renderer::FontDescriptor& font);
+            const CachedCell& cachedCell(const Layout& layout, Assets::Texture* texture, const Renderer::FontDescriptor& font);
 
             struct CompareByUsageCount;
             struct CompareByName;
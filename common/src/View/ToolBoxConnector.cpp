@@ -80,8 +80,11 @@ namespace TrenchBroom {
         bool ToolBoxConnector::dragMove(const int x, const int y, const std::string& text) {
             ensure(m_toolBox != nullptr, "toolBox is null");
 
+            // The drop receivers only need the closest hit, which they query themselves, so don't collect all hits on
+            // every move. The pick result is cleared so that it cannot refer to the dragged entity.
             mouseMoved(x, y);
-            updatePickResult();
+            m_inputState.setPickRequest(doGetPickRequest(m_inputState.mouseX(), m_inputState.mouseY()));
+            m_inputState.setPickResult(Model::PickResult());
 
             return m_toolBox->dragMove(m_toolChain, m_inputState, text);
         }
@@ -20,9 +20,13 @@
 #include <gtest/gtest.h>
 
 #include <vecmath/vec.h>
+#include <vecmath/plane.h>
 #include <vecmath/ray.h>
 #include "AABBTree.h"
 
+#include <set>
+#include <vector>
+
 namespace TrenchBroom {
     using AABB = AABBTree<double, 3, size_t>;
     using BOX = AABB::Box;
@@ -484,6 +488,169 @@ L [ ( -1 -1 -1 ) ( 1 1 1 ) ]: 1
         assertIntersectors(tree, RAY(VEC(0.0,  0.0,  0.0), VEC::pos_x()), { 2u });
     }
 
+    TEST(AABBTreeTest, findIntersectorsOfBox) {
+        AABB tree;
+        ASSERT_TRUE(tree.findIntersectors(BOX(VEC(-1.0, -1.0, -1.0), VEC(1.0, 1.0, 1.0))).empty());
+
+        tree.insert(BOX(VEC(-4.0, -1.0, -1.0), VEC(-2.0, +1.0, +1.0)), 1u);
+        tree.insert(BOX(VEC(+2.0, -1.0, -1.0), VEC(+4.0, +1.0, +1.0)), 2u);
+
+        const auto findIntersectors = [&](const BOX& box) {
+            const auto intersectors = tree.findIntersectors(box);
+            return std::set<AABB::DataType>(std::begin(intersectors), std::end(intersectors));
+        };
+
+        ASSERT_EQ(std::set<AABB::DataType>(), findIntersectors(BOX(VEC(-1.0, -1.0, -1.0), VEC(1.0, 1.0, 1.0))));
+        ASSERT_EQ(std::set<AABB::DataType>({ 1u }), findIntersectors(BOX(VEC(-3.0, -1.0, -1.0), VEC(1.0, 1.0, 1.0))));
+        ASSERT_EQ(std::set<AABB::DataType>({ 2u }), findIntersectors(BOX(VEC(1.0, 0.0, 0.0), VEC(5.0, 5.0, 5.0))));
+        ASSERT_EQ(std::set<AABB::DataType>({ 1u, 2u }), findIntersectors(BOX(VEC(-3.0, -1.0, -1.0), VEC(3.0, 1.0, 1.0))));
+        ASSERT_EQ(std::set<AABB::DataType>(), findIntersectors(BOX(VEC(-3.0, 2.0, -1.0), VEC(3.0, 3.0, 1.0))));
+    }
+
+    TEST(AABBTreeTest, findClosestIntersector) {
+        AABB tree;
+        const auto ray = RAY(VEC(-8.0, 0.0, 0.0), VEC::pos_x());
+
+        const auto hitBounds = [](const AABB::DataType) { return 0.0; };
+        ASSERT_TRUE(vm::is_nan(tree.findClosestIntersector(ray, hitBounds)));
+
+        // the items are hit where the ray enters their bounds
+        const auto hitDistance = [](const AABB::DataType data) { return static_cast<double>(data * 2u + 2u); };
+
+        tree.insert(BOX(VEC(+2.0, -1.0, -1.0), VEC(+4.0, +1.0, +1.0)), 4u);
+        tree.insert(BOX(VEC(-2.0, -1.0, -1.0), VEC(-1.0, +1.0, +1.0)), 2u);
+        tree.insert(BOX(VEC(+6.0, -1.0, -1.0), VEC(+7.0, +1.0, +1.0)), 6u);
+        tree.insert(BOX(VEC(-2.0, +2.0, -1.0), VEC(-1.0, +3.0, +1.0)), 3u);
+
+        std::vector<AABB::DataType> visited;
+        const auto distance = tree.findClosestIntersector(ray, [&](const AABB::DataType data) {
+            visited.push_back(data);
+            return hitDistance(data);
+        });
+
+        ASSERT_EQ(6.0, distance);
+
+        // only the closest item is tested, the others are entered behind its hit or not at all
+        ASSERT_EQ(std::vector<AABB::DataType>({ 2u }), visited);
+
+        // ignoring the closest item yields the next closest one
+        visited.clear();
+        ASSERT_EQ(10.0, tree.findClosestIntersector(ray, [&](const AABB::DataType data) {
+            visited.push_back(data);
+            return data == 2u ? vm::nan<double>() : hitDistance(data);
+        }));
+        ASSERT_EQ(std::vector<AABB::DataType>({ 2u, 4u }), visited);
+
+        ASSERT_TRUE(vm::is_nan(tree.findClosestIntersector(RAY(VEC(-8.0, 0.0, 0.0), VEC::neg_x()), hitBounds)));
+    }
+
+    TEST(AABBTreeTest, findIntersectorsWithPlanes) {
+        using PLANE = vm::plane<AABB::FloatType, AABB::Components>;
+
+        // the planes bounding the box ( -3 -2 -2 ) ( 5 2 2 ) and cutting off its corner at ( 5 2 z )
+        const auto planes = std::vector<PLANE>({
+            PLANE(VEC(-3.0, 0.0, 0.0), VEC::neg_x()),
+            PLANE(VEC(+5.0, 0.0, 0.0), VEC::pos_x()),
+            PLANE(VEC(0.0, -2.0, 0.0), VEC::neg_y()),
+            PLANE(VEC(0.0, +2.0, 0.0), VEC::pos_y()),
+            PLANE(VEC(0.0, 0.0, -2.0), VEC::neg_z()),
+            PLANE(VEC(0.0, 0.0, +2.0), VEC::pos_z()),
+            PLANE(VEC(+4.0, +2.0, 0.0), vm::normalize(VEC(1.0, 1.0, 0.0))),
+        });
+
+        AABB tree;
+        ASSERT_TRUE(tree.findIntersectors(planes).empty());
+
+        tree.insert(BOX(VEC(+2.0, -1.0, -1.0), VEC(+4.0, +1.0, +1.0)), 4u); // inside
+        tree.insert(BOX(VEC(-4.0, -1.0, -1.0), VEC(-2.0, +1.0, +1.0)), 2u); // partially inside
+        tree.insert(BOX(VEC(+6.0, -1.0, -1.0), VEC(+7.0, +1.0, +1.0)), 6u); // outside
+        tree.insert(BOX(VEC(+5.5, +1.5, -1.0), VEC(+6.0, +3.0, +1.0)), 5u); // outside, above the corner plane
+        tree.insert(BOX(VEC(+4.5, +1.5, -1.0), VEC(+5.0, +3.0, +1.0)), 3u); // touches the corner plane
+
+        const auto intersectors = tree.findIntersectors(planes);
+        ASSERT_EQ(std::set<AABB::DataType>({ 2u, 3u, 4u }), std::set<AABB::DataType>(std::begin(intersectors), std::end(intersectors)));
+    }
+
+    TEST(AABBTreeTest, clearAndBuildEmptyTree) {
+        AABB tree;
+        tree.clearAndBuild(std::vector<size_t>{}, [](const size_t i) { return makeBounds(i, i + 1u); });
+
+        ASSERT_TRUE(tree.empty());
+    }
+
+    TEST(AABBTreeTest, clearAndBuild) {
+        std::vector<size_t> data;
+        for (size_t i = 0u; i < 16u; ++i) {
+            data.push_back(i);
+        }
+
+        AABB tree;
+        tree.insert(makeBounds(100, 101), 100u);
+        tree.clearAndBuild(data, [](const size_t i) { return makeBounds(2u * i, 2u * i + 1u); });
+
+        ASSERT_FALSE(tree.contains(100u));
+        ASSERT_EQ(makeBounds(0, 31), tree.bounds());
+
+        // 16 leafs are split evenly into a tree of height 5
+        ASSERT_EQ(5u, tree.height());
+
+        for (const size_t i : data) {
+            assertTreeContains(tree, makeBounds(2u * i, 2u * i + 1u), i);
+        }
+
+        assertIntersectors(tree, RAY(VEC(-1.0, 0.0, 0.0), VEC::neg_x()), {});
+        assertIntersectors(tree, RAY(VEC(4.5, -2.0, 0.0), VEC::pos_y()), { 2u });
+        assertIntersectors(tree, RAY(VEC(5.5, -2.0, 0.0), VEC::pos_y()), {});
+    }
+
+    TEST(AABBTreeTest, clearAndBuildWithDuplicateData) {
+        AABB tree;
+        ASSERT_THROW(tree.clearAndBuild(std::vector<size_t>{ 1u, 2u, 1u }, [](const size_t i) { return makeBounds(i, i + 1u); }), NodeTreeException);
+
+        ASSERT_TRUE(tree.empty());
+        ASSERT_FALSE(tree.contains(1u));
+    }
+
+    TEST(AABBTreeTest, clearAndBuildWithNaNBounds) {
+        AABB tree;
+        ASSERT_THROW(tree.clearAndBuild(std::vector<size_t>{ 1u, 2u, 3u }, [](const size_t i) {
+            return i == 3u ? BOX(VEC(vm::nan<double>(), 0.0, 0.0), VEC(1.0, 1.0, 1.0)) : makeBounds(i, i + 1u);
+        }), NodeTreeException);
+
+        ASSERT_TRUE(tree.empty());
+        ASSERT_FALSE(tree.contains(1u));
+        ASSERT_FALSE(tree.contains(2u));
+
+        // the tree can be rebuilt after the failure
+        tree.clearAndBuild(std::vector<size_t>{ 1u, 2u }, [](const size_t i) { return makeBounds(i, i + 1u); });
+        assertTreeContains(tree, makeBounds(1u, 2u), 1u);
+        assertTreeContains(tree, makeBounds(2u, 3u), 2u);
+    }
+
+    TEST(AABBTreeTest, clearAndBuildTwice) {
+        const std::vector<size_t> data{ 1u, 2u, 3u };
+
+        AABB tree;
+        tree.clearAndBuild(data, [](const size_t i) { return makeBounds(i, i + 1u); });
+        tree.clearAndBuild(data, [](const size_t i) { return makeBounds(i, i + 1u); });
+
+        for (const size_t i : data) {
+            assertTreeContains(tree, makeBounds(i, i + 1u), i);
+        }
+    }
+
+    TEST(AABBTreeTest, insertAfterClear) {
+        const BOX bounds(VEC(0.0, 0.0, 0.0), VEC(2.0, 1.0, 1.0));
+
+        AABB tree;
+        tree.insert(bounds, 1u);
+        tree.clear();
+
+        ASSERT_FALSE(tree.contains(1u));
+        ASSERT_NO_THROW(tree.insert(bounds, 1u));
+        assertTreeContains(tree, bounds, 1u);
+    }
+
     void assertTree(const std::string& exp, const AABB& actual) {
         std::stringstream str;
         actual.print(str);
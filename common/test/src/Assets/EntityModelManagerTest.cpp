@@ -0,0 +1,151 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Exceptions.h"
+#include "Logger.h"
+#include "Assets/EntityModel.h"
+#include "Assets/EntityModelManager.h"
+#include "Assets/ModelDefinition.h"
+#include "IO/EntityModelLoader.h"
+#include "IO/Path.h"
+
+#include <vecmath/bbox.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Assets {
+        class TestModelLoader : public IO::EntityModelLoader {
+        private:
+            std::unique_ptr<EntityModel> doInitializeModel(const IO::Path& path, Logger& /* logger */) const override {
+                if (path.extension() != "mdl") {
+                    throw GameException("Unsupported model format '" + path.asString() + "'");
+                }
+
+                auto model = std::make_unique<EntityModel>(path.asString());
+                model->addFrames(2);
+                return model;
+            }
+
+            void doLoadFrame(const IO::Path& /* path */, const size_t frameIndex, EntityModel& model, Logger& /* logger */) const override {
+                model.loadFrame(frameIndex, "frame" + std::to_string(frameIndex), vm::bbox3f(16.0f));
+            }
+        };
+
+        static std::vector<IO::Path> waitForLoadedModels(EntityModelManager& manager) {
+            using namespace std::chrono_literals;
+
+            std::vector<IO::Path> result;
+            for (size_t i = 0; i < 1000u && result.empty(); ++i) {
+                result = manager.processLoadedModels();
+                if (result.empty()) {
+                    std::this_thread::sleep_for(10ms);
+                }
+            }
+            return result;
+        }
+
+        TEST(EntityModelManagerTest, loadModelInBackground) {
+            NullLogger logger;
+            TestModelLoader loader;
+
+            EntityModelManager manager(0, 0, logger);
+            manager.setLoader(&loader);
+
+            const auto spec = ModelSpecification(IO::Path("progs/test.mdl"), 0, 1);
+            ASSERT_EQ(nullptr, manager.frame(spec));
+            ASSERT_TRUE(manager.hasPendingModels());
+
+            ASSERT_EQ(std::vector<IO::Path>({ spec.path }), waitForLoadedModels(manager));
+            ASSERT_FALSE(manager.hasPendingModels());
+
+            const auto* frame = manager.frame(spec);
+            ASSERT_NE(nullptr, frame);
+            ASSERT_TRUE(frame->loaded());
+            ASSERT_EQ(1u, frame->index());
+
+            // frames that were not requested initially are loaded on demand
+            const auto* otherFrame = manager.frame(ModelSpecification(spec.path, 0, 0));
+            ASSERT_NE(nullptr, otherFrame);
+            ASSERT_TRUE(otherFrame->loaded());
+            ASSERT_FALSE(manager.hasPendingModels());
+        }
+
+        TEST(EntityModelManagerTest, loadInvalidModelInBackground) {
+            NullLogger logger;
+            TestModelLoader loader;
+
+            EntityModelManager manager(0, 0, logger);
+            manager.setLoader(&loader);
+
+            const auto spec = ModelSpecification(IO::Path("progs/test.xyz"), 0, 0);
+            ASSERT_EQ(nullptr, manager.frame(spec));
+
+            ASSERT_EQ(std::vector<IO::Path>({ spec.path }), waitForLoadedModels(manager));
+            ASSERT_FALSE(manager.hasPendingModels());
+
+            // the model is not loaded again
+            ASSERT_EQ(nullptr, manager.frame(spec));
+            ASSERT_FALSE(manager.hasPendingModels());
+        }
+
+        TEST(EntityModelManagerTest, clearWithPendingModels) {
+            NullLogger logger;
+            TestModelLoader loader;
+
+            EntityModelManager manager(0, 0, logger);
+            manager.setLoader(&loader);
+
+            ASSERT_EQ(nullptr, manager.frame(ModelSpecification(IO::Path("progs/test1.mdl"), 0, 0)));
+            ASSERT_EQ(nullptr, manager.frame(ModelSpecification(IO::Path("progs/test2.mdl"), 0, 0)));
+            ASSERT_TRUE(manager.hasPendingModels());
+
+            manager.clear();
+            ASSERT_FALSE(manager.hasPendingModels());
+            ASSERT_TRUE(manager.processLoadedModels().empty());
+        }
+
+        TEST(EntityModelManagerTest, cancelPendingLoads) {
+            NullLogger logger;
+            TestModelLoader loader;
+
+            EntityModelManager manager(0, 0, logger);
+            manager.setLoader(&loader);
+
+            const auto spec = ModelSpecification(IO::Path("progs/test.mdl"), 0, 0);
+            ASSERT_EQ(nullptr, manager.frame(spec));
+            ASSERT_TRUE(manager.hasPendingModels());
+
+            manager.cancelPendingLoads();
+            ASSERT_FALSE(manager.hasPendingModels());
+            ASSERT_TRUE(manager.processLoadedModels().empty());
+
+            // the cancelled model is requested again on the next access
+            ASSERT_EQ(nullptr, manager.frame(spec));
+            ASSERT_TRUE(manager.hasPendingModels());
+            ASSERT_EQ(std::vector<IO::Path>({ spec.path }), waitForLoadedModels(manager));
+            ASSERT_NE(nullptr, manager.frame(spec));
+        }
+    }
+}
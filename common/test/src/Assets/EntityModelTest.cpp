@@ -0,0 +1,87 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Assets/EntityModel.h"
+#include "Renderer/IndexRangeMap.h"
+#include "Renderer/PrimType.h"
+#include "Renderer/VertexArray.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/ray.h>
+#include <vecmath/scalar.h>
+#include <vecmath/vec.h>
+
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Assets {
+        static std::vector<EntityModelVertex> makeTriangle(const float z) {
+            return {
+                EntityModelVertex(vm::vec3f(0.0f, 0.0f, z), vm::vec2f(0.0f, 0.0f)),
+                EntityModelVertex(vm::vec3f(1.0f, 0.0f, z), vm::vec2f(1.0f, 0.0f)),
+                EntityModelVertex(vm::vec3f(0.0f, 1.0f, z), vm::vec2f(0.0f, 1.0f))
+            };
+        }
+
+        TEST(EntityModelTest, surfacesShareFrameVertices) {
+            EntityModel model("model");
+            model.addFrames(2);
+
+            auto& surface1 = model.addSurface("surface1");
+            auto& surface2 = model.addSurface("surface2");
+
+            auto& frame = model.loadFrame(0, "frame", vm::bbox3f(1.0f));
+            surface1.addIndexedMesh(frame, makeTriangle(0.0f), Renderer::IndexRangeMap(Renderer::PrimType::Triangles, 0, 3));
+            surface2.addIndexedMesh(frame, makeTriangle(1.0f), Renderer::IndexRangeMap(Renderer::PrimType::Triangles, 0, 3));
+
+            ASSERT_EQ(6u, frame.vertexCount());
+            ASSERT_EQ(0u, model.frame(1)->vertexCount());
+            ASSERT_EQ(6u, model.vertexCount());
+            ASSERT_EQ(6u * sizeof(EntityModelVertex), model.vertexDataSize());
+
+            const auto& vertexArray = frame.vertexArray();
+            ASSERT_EQ(6u, vertexArray.vertexCount());
+
+            // the vertex count is retained after the vertices were moved into the vertex array
+            ASSERT_EQ(6u, frame.vertexCount());
+        }
+
+        TEST(EntityModelTest, buildSpacialTreeOnDemand) {
+            EntityModel model("model");
+            model.addFrames(1);
+
+            auto& surface = model.addSurface("surface");
+            auto& frame = model.loadFrame(0, "frame", vm::bbox3f(vm::vec3f::zero(), vm::vec3f(1.0f, 1.0f, 1.0f)));
+            surface.addIndexedMesh(frame, makeTriangle(0.0f), Renderer::IndexRangeMap(Renderer::PrimType::Triangles, 0, 3));
+            surface.addIndexedMesh(frame, makeTriangle(1.0f), Renderer::IndexRangeMap(Renderer::PrimType::Triangles, 0, 3));
+
+            ASSERT_FALSE(frame.hasSpacialTree());
+
+            // a ray that misses the frame bounds does not build the tree
+            ASSERT_TRUE(vm::is_nan(frame.intersect(vm::ray3f(vm::vec3f(5.0f, 5.0f, 5.0f), vm::vec3f::pos_z()))));
+            ASSERT_FALSE(frame.hasSpacialTree());
+
+            const auto ray = vm::ray3f(vm::vec3f(0.25f, 0.25f, 2.0f), vm::vec3f::neg_z());
+            ASSERT_FLOAT_EQ(1.0f, frame.intersect(ray));
+            ASSERT_TRUE(frame.hasSpacialTree());
+        }
+    }
+}
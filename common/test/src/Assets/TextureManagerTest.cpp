@@ -0,0 +1,101 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "InternedString.h"
+#include "Logger.h"
+#include "Assets/Texture.h"
+#include "Assets/TextureCollection.h"
+#include "Assets/TextureManager.h"
+#include "IO/Path.h"
+
+#include <string>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Assets {
+        static std::vector<std::string> names(const std::vector<Texture*>& textures) {
+            std::vector<std::string> result;
+            for (const auto* texture : textures) {
+                result.push_back(texture->name());
+            }
+            return result;
+        }
+
+        class TextureManagerTest : public ::testing::Test {
+        protected:
+            NullLogger logger;
+            TextureManager manager;
+
+            TextureManagerTest() :
+            manager(0, 0, logger) {
+                auto* collection1 = new TextureCollection(IO::Path("coll1"), std::vector<Texture*>{
+                    new Texture("base/Water1", 16, 16),
+                    new Texture("base/lava", 16, 16),
+                    new Texture("sky1", 16, 16)
+                });
+                auto* collection2 = new TextureCollection(IO::Path("coll2"), std::vector<Texture*>{
+                    new Texture("SKY1", 16, 16),
+                    new Texture("100%_water", 16, 16)
+                });
+                manager.setTextureCollections(std::vector<TextureCollection*>{ collection1, collection2 });
+            }
+        };
+
+        TEST_F(TextureManagerTest, textureIgnoresCase) {
+            ASSERT_NE(nullptr, manager.texture("base/water1"));
+            ASSERT_EQ(manager.texture("base/water1"), manager.texture("BASE/WATER1"));
+            ASSERT_EQ("SKY1", manager.texture("sky1")->name());
+            ASSERT_EQ(nullptr, manager.texture("water1"));
+        }
+
+        TEST_F(TextureManagerTest, textureByInternedName) {
+            ASSERT_EQ(manager.texture("base/water1"), manager.texture(InternedString("base/water1")));
+            ASSERT_EQ(manager.texture("base/water1"), manager.texture(InternedString("BASE/Water1")));
+            ASSERT_EQ("SKY1", manager.texture(InternedString("sky1"))->name());
+            ASSERT_EQ(nullptr, manager.texture(InternedString("water1")));
+        }
+
+        TEST_F(TextureManagerTest, findTextures) {
+            ASSERT_EQ(std::vector<std::string>({ "base/lava", "base/Water1" }), names(manager.findTextures("base/*")));
+            ASSERT_EQ(2u, manager.findTextures("SKY?").size());
+            ASSERT_EQ(std::vector<std::string>({ "base/lava" }), names(manager.findTextures("*lava")));
+            ASSERT_TRUE(manager.findTextures("lava").empty());
+        }
+
+        TEST_F(TextureManagerTest, findTexturesContaining) {
+            ASSERT_EQ(std::vector<std::string>({ "100%_water", "base/Water1" }), names(manager.findTexturesContaining("WATER")));
+            ASSERT_EQ(std::vector<std::string>({ "100%_water" }), names(manager.findTexturesContaining("0%_")));
+            ASSERT_EQ(std::vector<std::string>({ "base/lava" }), names(manager.findTexturesContaining("e/l")));
+            ASSERT_EQ(5u, manager.findTexturesContaining("").size());
+            ASSERT_TRUE(manager.findTexturesContaining("*").empty());
+        }
+
+        TEST_F(TextureManagerTest, updateIndexWhenCollectionsChange) {
+            ASSERT_EQ(2u, manager.findTexturesContaining("water").size());
+
+            manager.setTextureCollections(std::vector<TextureCollection*>{
+                new TextureCollection(IO::Path("coll3"), std::vector<Texture*>{ new Texture("water2", 16, 16) })
+            });
+
+            ASSERT_EQ(std::vector<std::string>({ "water2" }), names(manager.findTexturesContaining("water")));
+        }
+    }
+}
@@ -23,9 +23,12 @@
 #include "Macros.h"
 #include "IO/DiskFileSystem.h"
 #include "IO/DiskIO.h"
+#include "IO/File.h"
 #include "IO/FileMatcher.h"
+#include "IO/IdPakFileSystem.h"
 #include "IO/Path.h"
 #include "IO/PathQt.h"
+#include "IO/Reader.h"
 #include "IO/TestEnvironment.h"
 
 #include <algorithm>
@@ -69,6 +72,77 @@ namespace TrenchBroom {
             ASSERT_EQ(env.dir() + Path("dir1/asdf.map"), absPathNotExisting);
         }
 
+        TEST(FileSystemTest, buildIndex) {
+            FSTestEnvironment env;
+
+            // the two archives form a run in the middle of the chain, which is indexed as a whole
+            std::shared_ptr<FileSystem> chain = std::make_shared<DiskFileSystem>(env.dir() + Path("anotherDir"));
+            chain = std::make_shared<IdPakFileSystem>(chain, Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Pak/pak1.pak"));
+            chain = std::make_shared<IdPakFileSystem>(chain, Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Pak/pak3.pak"));
+            chain = std::make_shared<DiskFileSystem>(chain, env.dir());
+            chain->buildIndex();
+            ASSERT_TRUE(chain->hasIndex());
+
+            ASSERT_TRUE(chain->directoryExists(Path("dir1")));
+            ASSERT_TRUE(chain->directoryExists(Path("Textures/E1U2")));
+            ASSERT_TRUE(chain->directoryExists(Path("SUBDIRTEST")));
+            ASSERT_FALSE(chain->directoryExists(Path("test.txt")));
+            ASSERT_TRUE(chain->fileExists(Path("test.txt")));
+            ASSERT_TRUE(chain->fileExists(Path("gfx/palette.lmp")));
+            ASSERT_TRUE(chain->fileExists(Path("AMNET.cfg")));
+            ASSERT_TRUE(chain->fileExists(Path("Test3.map")));
+            ASSERT_FALSE(chain->fileExists(Path("textures")));
+            ASSERT_FALSE(chain->fileExists(Path("asdf.map")));
+
+            // files are resolved against the first file system in the chain that contains them
+            ASSERT_EQ(env.dir() + Path("test2.map"), chain->makeAbsolute(Path("test2.map")));
+            ASSERT_EQ(env.dir() + Path("anotherDir/test3.map"), chain->makeAbsolute(Path("test3.map")));
+            ASSERT_EQ(env.dir() + Path("asdf.map"), chain->makeAbsolute(Path("asdf.map")));
+
+            ASSERT_NE(nullptr, chain->openFile(Path("amnet.cfg")));
+            const auto file = chain->openFile(Path("anotherDir/test3.map"));
+            ASSERT_EQ(std::string("//yet another test file\n{}"), file->reader().readString(file->size()));
+            ASSERT_THROW(chain->openFile(Path("asdf.map")), FileSystemException);
+
+            // the contents of all file systems are merged
+            ASSERT_EQ(std::vector<Path>({
+                Path("amnet.cfg"),
+                Path("anotherDir"),
+                Path("bear.cfg"),
+                Path("dir1"),
+                Path("dir2"),
+                Path("gfx"),
+                Path("pics"),
+                Path("subDirTest"),
+                Path("test.txt"),
+                Path("test2.map"),
+                Path("test3.map"),
+                Path("textures")
+            }), chain->getDirectoryContents(Path("")));
+
+            ASSERT_EQ(std::vector<Path>({
+                Path("amnet.cfg"),
+                Path("bear.cfg")
+            }), chain->findItemsRecursively(Path(""), FileExtensionMatcher("cfg")));
+
+            ASSERT_EQ(std::vector<Path>({
+                Path("anotherDir/subDirTest/test2.map"),
+                Path("anotherDir/test3.map"),
+                Path("subDirTest/test2.map"),
+                Path("test2.map"),
+                Path("test3.map")
+            }), chain->findItemsRecursively(Path(""), FileExtensionMatcher("map")));
+
+            // the directories on disk are not indexed, so new files are found without rebuilding the index
+            env.createFile(Path("test4.map"), "");
+            ASSERT_TRUE(chain->fileExists(Path("test4.map")));
+            ASSERT_EQ(env.dir() + Path("test4.map"), chain->makeAbsolute(Path("test4.map")));
+
+            chain->clearIndex();
+            ASSERT_FALSE(chain->hasIndex());
+            ASSERT_TRUE(chain->fileExists(Path("amnet.cfg")));
+        }
+
         TEST(DiskTest, fixPath) {
             FSTestEnvironment env;
 
@@ -0,0 +1,89 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Color.h"
+#include "Assets/EntityDefinition.h"
+#include "IO/DiskIO.h"
+#include "IO/EntityDefinitionCache.h"
+#include "IO/FgdParser.h"
+#include "IO/File.h"
+#include "IO/Path.h"
+#include "IO/Reader.h"
+#include "IO/TestEnvironment.h"
+#include "IO/TestParserStatus.h"
+
+#include <kdl/vector_utils.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace IO {
+        static std::vector<std::string> names(const std::vector<Assets::EntityDefinition*>& definitions) {
+            return kdl::vec_transform(definitions, [](const auto* definition) { return definition->name(); });
+        }
+
+        TEST(EntityDefinitionCacheTest, findCachedDefinitions) {
+            TestEnvironment env("entitydefinitioncachetest");
+            env.createFile(Path("include.fgd"), "@PointClass = info_player_start : \"Player start\" []\n");
+            env.createFile(Path("host.fgd"), "@SolidClass = worldspawn : \"World entity\" []\n@include \"include.fgd\"\n");
+
+            const auto path = env.dir() + Path("host.fgd");
+            const auto contents = Disk::readFile(path);
+            const auto defaultColor = Color(1.0f, 1.0f, 1.0f, 1.0f);
+
+            FgdParser parser(contents, defaultColor, path);
+            TestParserStatus status;
+            auto definitions = parser.parseDefinitions(status);
+            ASSERT_EQ(std::vector<std::string>({ "worldspawn", "info_player_start" }), names(definitions));
+
+            auto cache = EntityDefinitionCache();
+            ASSERT_FALSE(cache.find(path, contents, defaultColor).has_value());
+
+            cache.put(path, contents, parser.includedPaths(), defaultColor, definitions);
+
+            auto cachedDefinitions = cache.find(path, contents, defaultColor);
+            ASSERT_TRUE(cachedDefinitions.has_value());
+            ASSERT_EQ(names(definitions), names(*cachedDefinitions));
+
+            // the cached definitions are copies which share the attribute definitions
+            for (size_t i = 0u; i < definitions.size(); ++i) {
+                ASSERT_NE(definitions[i], (*cachedDefinitions)[i]);
+                ASSERT_EQ(definitions[i]->type(), (*cachedDefinitions)[i]->type());
+                ASSERT_EQ(definitions[i]->attributeDefinitions(), (*cachedDefinitions)[i]->attributeDefinitions());
+            }
+
+            ASSERT_FALSE(cache.find(path, contents, Color(1.0f, 0.0f, 0.0f, 1.0f)).has_value());
+            ASSERT_FALSE(cache.find(path, contents + "\n", defaultColor).has_value());
+
+            // changing an included file invalidates the cached definitions
+            env.createFile(Path("include.fgd"), "@PointClass = info_player_deathmatch : \"Deathmatch start\" []\n");
+            ASSERT_FALSE(cache.find(path, contents, defaultColor).has_value());
+
+            cache.clear();
+            ASSERT_FALSE(cache.find(path, contents, defaultColor).has_value());
+
+            kdl::vec_clear_and_delete(*cachedDefinitions);
+            kdl::vec_clear_and_delete(definitions);
+        }
+    }
+}
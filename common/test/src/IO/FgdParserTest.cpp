@@ -832,6 +832,9 @@ decor_goddess_statue : "Goddess Statue" [])";
             ASSERT_TRUE(std::any_of(std::begin(defs), std::end(defs), [](const auto* def) { return def->name() == "worldspawn"; }));
             ASSERT_TRUE(std::any_of(std::begin(defs), std::end(defs), [](const auto* def) { return def->name() == "info_player_start"; }));
 
+            ASSERT_FALSE(parser.includeFailed());
+            ASSERT_EQ(std::vector<Path>({ file->path().deleteLastComponent() + Path("include.fgd") }), parser.includedPaths());
+
             kdl::vec_clear_and_delete(defs);
         }
 
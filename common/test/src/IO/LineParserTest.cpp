@@ -0,0 +1,120 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "IO/LineParser.h"
+
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace IO {
+        TEST(LineParserTest, parseInteger) {
+            auto parser = LineParser("  12 -3 +4 x");
+            ASSERT_EQ(12, parser.parseInteger());
+            ASSERT_EQ(-3, parser.parseInteger());
+            ASSERT_EQ(4, parser.parseInteger());
+            ASSERT_EQ(std::nullopt, parser.parseInteger());
+            ASSERT_FALSE(parser.eol());
+            ASSERT_TRUE(parser.consume('x'));
+            ASSERT_TRUE(parser.eol());
+            ASSERT_EQ(std::nullopt, parser.parseInteger());
+        }
+
+        TEST(LineParserTest, parseIntegerOverflow) {
+            const auto max = std::to_string(std::numeric_limits<long>::max());
+            ASSERT_EQ(std::numeric_limits<long>::max(), LineParser(max).parseInteger());
+            ASSERT_EQ(-std::numeric_limits<long>::max(), LineParser("-" + max).parseInteger());
+
+            ASSERT_EQ(std::nullopt, LineParser(max + "0").parseInteger());
+            ASSERT_EQ(std::nullopt, LineParser("99999999999999999999999999999999").parseInteger());
+        }
+
+        TEST(LineParserTest, parseFloat) {
+            auto parser = LineParser("0 -96 64.5 -.25 1e3 2.5E-2 1.e 7");
+            ASSERT_EQ(0.0f, parser.parseFloat());
+            ASSERT_EQ(-96.0f, parser.parseFloat());
+            ASSERT_EQ(64.5f, parser.parseFloat());
+            ASSERT_EQ(-0.25f, parser.parseFloat());
+            ASSERT_EQ(1000.0f, parser.parseFloat());
+            ASSERT_EQ(0.025f, parser.parseFloat());
+
+            // an 'e' without an exponent is not part of the number
+            ASSERT_EQ(1.0f, parser.parseFloat());
+            ASSERT_EQ(std::nullopt, parser.parseFloat());
+            ASSERT_TRUE(parser.consume('e'));
+            ASSERT_EQ(7.0f, parser.parseFloat());
+            ASSERT_TRUE(parser.eol());
+
+            auto invalid = LineParser("- . (1)");
+            ASSERT_EQ(std::nullopt, invalid.parseFloat());
+            ASSERT_TRUE(invalid.consume('-'));
+            ASSERT_EQ(std::nullopt, invalid.parseFloat());
+            ASSERT_TRUE(invalid.consume('.'));
+            ASSERT_TRUE(invalid.consume('('));
+            ASSERT_EQ(1.0f, invalid.parseFloat());
+            ASSERT_TRUE(invalid.consume(')'));
+        }
+
+        TEST(LineParserTest, parseFloatMatchesStrtof) {
+            for (const auto* str : { "3.14159265358979", "-1234.5678", "0.1", "123456789012345678901234", "1e-10", "8192.000001" }) {
+                auto parser = LineParser(str);
+                ASSERT_EQ(std::strtof(str, nullptr), parser.parseFloat()) << str;
+            }
+        }
+
+        TEST(LineParserTest, nextLine) {
+            auto text = std::string_view("first\r\nsecond\n\nlast");
+            ASSERT_EQ(std::string_view("first"), nextLine(text));
+            ASSERT_EQ(std::string_view("second"), nextLine(text));
+            ASSERT_EQ(std::string_view(""), nextLine(text));
+            ASSERT_EQ(std::string_view("last"), nextLine(text));
+            ASSERT_EQ(std::nullopt, nextLine(text));
+        }
+
+        TEST(LineParserTest, nextLines) {
+            auto text = std::string_view("1\n2\n3\n");
+            ASSERT_EQ(std::vector<std::string_view>({ "1", "2" }), nextLines(text, 2u));
+            ASSERT_EQ(std::vector<std::string_view>({ "3" }), nextLines(text, 2u));
+            ASSERT_TRUE(nextLines(text, 2u).empty());
+        }
+
+        TEST(LineParserTest, parseLines) {
+            std::vector<std::string> strings;
+            for (long i = 0; i < 5000; ++i) {
+                strings.push_back(std::to_string(i));
+            }
+            const auto lines = std::vector<std::string_view>(std::begin(strings), std::end(strings));
+
+            const auto values = parseLines(lines, [](const std::string_view line) {
+                return *LineParser(line).parseInteger();
+            });
+
+            ASSERT_EQ(lines.size(), values.size());
+            for (size_t i = 0u; i < values.size(); ++i) {
+                ASSERT_EQ(static_cast<long>(i), values[i]);
+            }
+        }
+    }
+}
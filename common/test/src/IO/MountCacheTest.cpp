@@ -0,0 +1,144 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "IO/DiskIO.h"
+#include "IO/IdPakFileSystem.h"
+#include "IO/MountCache.h"
+#include "IO/Path.h"
+#include "IO/TestEnvironment.h"
+#include "IO/ZipFileSystem.h"
+
+#include <vector>
+
+namespace TrenchBroom {
+    namespace IO {
+        TEST(MountCacheTest, mountZipFromCache) {
+            const auto zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+
+            auto mountCache = MountCache();
+            ASSERT_EQ(nullptr, mountCache.find(zipPath));
+
+            const ZipFileSystem uncachedFS(nullptr, zipPath, &mountCache);
+            ASSERT_TRUE(mountCache.modified());
+            ASSERT_EQ(1u, mountCache.archiveCount());
+
+            const auto* entries = mountCache.find(zipPath);
+            ASSERT_NE(nullptr, entries);
+            ASSERT_EQ(11u, entries->size());
+
+            const ZipFileSystem cachedFS(nullptr, zipPath, &mountCache);
+            ASSERT_EQ(uncachedFS.findItemsRecursively(Path("")), cachedFS.findItemsRecursively(Path("")));
+
+            const auto uncachedFile = uncachedFS.openFile(Path("amnet.cfg"));
+            const auto cachedFile = cachedFS.openFile(Path("amnet.cfg"));
+            ASSERT_EQ(uncachedFile->size(), cachedFile->size());
+        }
+
+        TEST(MountCacheTest, mountPakFromCache) {
+            const auto pakPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Pak/pak3.pak");
+
+            auto mountCache = MountCache();
+            const IdPakFileSystem uncachedFS(nullptr, pakPath, &mountCache);
+            ASSERT_NE(nullptr, mountCache.find(pakPath));
+
+            const IdPakFileSystem cachedFS(nullptr, pakPath, &mountCache);
+            ASSERT_EQ(uncachedFS.findItemsRecursively(Path("")), cachedFS.findItemsRecursively(Path("")));
+        }
+
+        TEST(MountCacheTest, writeAndRead) {
+            const auto zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+            const auto pakPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Pak/pak3.pak");
+
+            auto mountCache = MountCache();
+            mountCache.put(zipPath, {
+                ArchiveEntry(Path("pics/tag1.pcx"), 1u, 0u),
+                ArchiveEntry(Path("amnet.cfg"), 2u, 0u),
+            });
+            mountCache.put(pakPath, {
+                ArchiveEntry(Path("sound/blah.wav"), 12u, 34u),
+                ArchiveEntry(Path("compressed.wal"), 56u, 78u, 90u, true),
+            });
+            mountCache.put(Path("/does/not/exist.pak"), {});
+
+            TestEnvironment env("mountcachetest");
+            const auto cachePath = env.dir() + Path("cache/game.mounts");
+            mountCache.write(cachePath);
+
+            // the missing archive is omitted
+            const auto readCache = MountCache::read(cachePath);
+            ASSERT_EQ(2u, readCache.archiveCount());
+            ASSERT_TRUE(readCache.modified());
+
+            ASSERT_NE(nullptr, readCache.find(zipPath));
+            ASSERT_EQ(*mountCache.find(zipPath), *readCache.find(zipPath));
+            ASSERT_NE(nullptr, readCache.find(pakPath));
+            ASSERT_EQ(*mountCache.find(pakPath), *readCache.find(pakPath));
+        }
+
+        TEST(MountCacheTest, pruneUnusedArchives) {
+            const auto zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+            const auto pakPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Pak/pak3.pak");
+
+            auto mountCache = MountCache();
+            mountCache.put(zipPath, { ArchiveEntry(Path("amnet.cfg"), 2u, 0u) });
+            mountCache.put(pakPath, { ArchiveEntry(Path("sound/blah.wav"), 12u, 34u) });
+
+            TestEnvironment env("mountcachetest");
+            const auto cachePath = env.dir() + Path("game.mounts");
+            mountCache.write(cachePath);
+
+            // only the zip archive is mounted in the next session
+            auto readCache = MountCache::read(cachePath);
+            ASSERT_EQ(2u, readCache.archiveCount());
+            ASSERT_TRUE(readCache.modified());
+            ASSERT_NE(nullptr, readCache.find(zipPath));
+            readCache.write(cachePath);
+
+            const auto prunedCache = MountCache::read(cachePath);
+            ASSERT_EQ(1u, prunedCache.archiveCount());
+            ASSERT_NE(nullptr, prunedCache.find(zipPath));
+            ASSERT_EQ(nullptr, prunedCache.find(pakPath));
+        }
+
+        TEST(MountCacheTest, readInvalidFile) {
+            TestEnvironment env("mountcachetest");
+            ASSERT_EQ(0u, MountCache::read(env.dir() + Path("missing.mounts")).archiveCount());
+
+            env.createFile(Path("garbage.mounts"), "TBMC this is not a mount cache");
+            const auto readCache = MountCache::read(env.dir() + Path("garbage.mounts"));
+            ASSERT_EQ(0u, readCache.archiveCount());
+            ASSERT_FALSE(readCache.modified());
+        }
+
+        TEST(MountCacheTest, findChangedArchive) {
+            TestEnvironment env("mountcachetest");
+            env.createFile(Path("test.pak"), "some contents");
+
+            const auto archivePath = env.dir() + Path("test.pak");
+            auto mountCache = MountCache();
+            mountCache.put(archivePath, { ArchiveEntry(Path("file.txt"), 0u, 1u) });
+            ASSERT_NE(nullptr, mountCache.find(archivePath));
+
+            env.createFile(Path("test.pak"), "some other contents");
+            ASSERT_EQ(nullptr, mountCache.find(archivePath));
+        }
+    }
+}
@@ -26,6 +26,7 @@
 #include "IO/FileMatcher.h"
 #include "IO/Path.h"
 #include "IO/Quake3ShaderFileSystem.h"
+#include "IO/TestEnvironment.h"
 
 #include <memory>
 
@@ -87,6 +88,34 @@ namespace TrenchBroom {
             assertShader(items, texturePrefix + Path("test/not_existing2"));
         }
 
+        TEST(Quake3ShaderFileSystemTest, testReloadLinksNewTextures) {
+            NullLogger logger;
+
+            TestEnvironment env("shaderreloadtest");
+            env.createDirectory(Path("scripts"));
+            env.createDirectory(Path("textures/test"));
+            env.createFile(Path("textures/test/old.tga"), "");
+
+            const auto texturePrefix = Path("textures");
+            std::shared_ptr<FileSystem> diskFS = std::make_shared<DiskFileSystem>(env.dir());
+            auto shaderFS = std::make_shared<Quake3ShaderFileSystem>(diskFS, Path("scripts"), std::vector<Path> { texturePrefix }, logger);
+            std::shared_ptr<FileSystem> fs = shaderFS;
+
+            // linking the shaders during the reload must not see an index that was built before the reload
+            fs->buildIndex();
+
+            ASSERT_TRUE(fs->fileExists(texturePrefix + Path("test/old")));
+            ASSERT_FALSE(fs->fileExists(texturePrefix + Path("test/new")));
+
+            env.createFile(Path("textures/test/new.tga"), "");
+            shaderFS->reload();
+
+            const auto items = fs->findItems(texturePrefix + Path("test"), FileExtensionMatcher(""));
+            ASSERT_EQ(2u, items.size());
+            assertShader(items, texturePrefix + Path("test/old"));
+            assertShader(items, texturePrefix + Path("test/new"));
+        }
+
         void assertShader(const std::vector<Path>& paths, const Path& path) {
             ASSERT_EQ(1, std::count_if(std::begin(paths), std::end(paths), [&path](const auto& item) { return item == path; }));
         }
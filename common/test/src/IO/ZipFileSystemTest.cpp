@@ -22,11 +22,18 @@
 #include "Exceptions.h"
 #include "IO/DiskIO.h"
 #include "IO/DiskFileSystem.h"
+#include "IO/File.h"
 #include "IO/FileMatcher.h"
+#include "IO/Reader.h"
 #include "IO/ZipFileSystem.h"
 
+#include <kdl/parallel.h>
+
 #include <algorithm>
 #include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace TrenchBroom {
     namespace IO {
@@ -140,5 +147,53 @@ namespace TrenchBroom {
 
             ASSERT_TRUE(fs.openFile(Path("amnet.cfg")) != nullptr);
         }
+
+        TEST(ZipFileSystemTest, openFileTwice) {
+            const Path zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+
+            const ZipFileSystem fs(zipPath);
+            const auto file = fs.openFile(Path("textures/e1u1/brlava.wal"));
+            ASSERT_TRUE(file != nullptr);
+
+            // the decompressed entry is reused
+            ASSERT_EQ(file, fs.openFile(Path("textures/e1u1/brlava.wal")));
+        }
+
+        TEST(ZipFileSystemTest, openFileFromSeveralArchives) {
+            const Path zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+
+            const ZipFileSystem fs1(zipPath);
+            const ZipFileSystem fs2(zipPath);
+
+            // the entry cache is shared by all archives, but entries are cached per archive
+            const auto file1 = fs1.openFile(Path("textures/e1u1/brlava.wal"));
+            const auto file2 = fs2.openFile(Path("textures/e1u1/brlava.wal"));
+            ASSERT_NE(file1, file2);
+            ASSERT_EQ(file1, fs1.openFile(Path("textures/e1u1/brlava.wal")));
+            ASSERT_EQ(file2, fs2.openFile(Path("textures/e1u1/brlava.wal")));
+        }
+
+        TEST(ZipFileSystemTest, openFilesInParallel) {
+            const Path zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+
+            const ZipFileSystem sequentialFS(zipPath);
+            const auto paths = sequentialFS.findItemsRecursively(Path(""), FileExtensionMatcher("wal"));
+            ASSERT_EQ(7u, paths.size());
+
+            std::vector<std::string> expected;
+            for (const auto& path : paths) {
+                auto reader = sequentialFS.openFile(path)->reader().buffer();
+                expected.emplace_back(reader.begin(), reader.end());
+            }
+
+            const ZipFileSystem parallelFS(zipPath);
+            std::vector<std::string> actual(paths.size());
+            kdl::parallel_for(paths.size(), [&](const size_t i) {
+                auto reader = parallelFS.openFile(paths[i])->reader().buffer();
+                actual[i] = std::string(reader.begin(), reader.end());
+            });
+
+            ASSERT_EQ(expected, actual);
+        }
     }
 }
@@ -0,0 +1,75 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "InternedString.h"
+
+#include <string>
+#include <unordered_set>
+
+namespace TrenchBroom {
+    TEST(InternedStringTest, defaultConstruct) {
+        ASSERT_TRUE(InternedString().empty());
+        ASSERT_EQ(std::string(""), InternedString().str());
+        ASSERT_EQ(InternedString(), InternedString(""));
+    }
+
+    TEST(InternedStringTest, compare) {
+        ASSERT_EQ(InternedString("classname"), InternedString("classname"));
+        ASSERT_EQ(&InternedString("classname").str(), &InternedString("classname").str());
+        ASSERT_NE(InternedString("classname"), InternedString("Classname"));
+        ASSERT_TRUE(InternedString("classname") == "classname");
+        ASSERT_TRUE(InternedString("classname") != "origin");
+
+        ASSERT_TRUE(InternedString("classname") < InternedString("origin"));
+        ASSERT_FALSE(InternedString("origin") < InternedString("classname"));
+        ASSERT_FALSE(InternedString("origin") < InternedString("origin"));
+    }
+
+    TEST(InternedStringTest, hash) {
+        const auto strings = std::unordered_set<InternedString>({
+            InternedString("classname"),
+            InternedString("classname"),
+            InternedString("origin")
+        });
+        ASSERT_EQ(2u, strings.size());
+        ASSERT_EQ(1u, strings.count(InternedString("origin")));
+    }
+
+    TEST(InternedStringTest, lowerCase) {
+        ASSERT_EQ(InternedString("base/water1"), InternedString("BASE/Water1").lowerCase());
+        ASSERT_EQ(InternedString("base/water1"), InternedString("base/water1").lowerCase());
+        ASSERT_EQ(InternedString("BASE/Water1").lowerCase(), InternedString("BASE/Water1").lowerCase());
+    }
+
+    TEST(InternedStringTest, statistics) {
+        const auto before = InternedString::statistics();
+        const auto str = std::string("a string that is interned for the statistics test");
+
+        InternedString(str.c_str());
+        InternedString(str.c_str());
+
+        const auto after = InternedString::statistics();
+        ASSERT_EQ(before.distinctStrings + 1u, after.distinctStrings);
+        ASSERT_EQ(before.storedBytes + str.size(), after.storedBytes);
+        ASSERT_EQ(before.internedStrings + 2u, after.internedStrings);
+        ASSERT_EQ(before.internedBytes + 2u * str.size(), after.internedBytes);
+    }
+}
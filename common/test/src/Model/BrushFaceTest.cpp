@@ -55,7 +55,7 @@ namespace TrenchBroom {
             const vm::vec3 p2(0.0, -1.0, 4.0);
 
             const BrushFaceAttributes attribs("");
-            BrushFace face(p0, p1, p2, attribs, std::make_unique<ParaxialTexCoordSystem>(p0, p1, p2, attribs));
+            BrushFace face(p0, p1, p2, attribs, ParaxialTexCoordSystem(p0, p1, p2, attribs));
             ASSERT_VEC_EQ(p0, face.points()[0]);
             ASSERT_VEC_EQ(p1, face.points()[1]);
             ASSERT_VEC_EQ(p2, face.points()[2]);
@@ -69,7 +69,7 @@ namespace TrenchBroom {
             const vm::vec3 p2(2.0, 0.0, 4.0);
 
             const BrushFaceAttributes attribs("");
-            ASSERT_THROW(new BrushFace(p0, p1, p2, attribs, std::make_unique<ParaxialTexCoordSystem>(p0, p1, p2, attribs)), GeometryException);
+            ASSERT_THROW(new BrushFace(p0, p1, p2, attribs, ParaxialTexCoordSystem(p0, p1, p2, attribs)), GeometryException);
         }
 
         TEST(BrushFaceTest, textureUsageCount) {
@@ -89,7 +89,7 @@ namespace TrenchBroom {
 
             {
                 // test constructor
-                BrushFace face(p0, p1, p2, attribs, std::make_unique<ParaxialTexCoordSystem>(p0, p1, p2, attribs));
+                BrushFace face(p0, p1, p2, attribs, ParaxialTexCoordSystem(p0, p1, p2, attribs));
                 EXPECT_EQ(2u, texture.usageCount());
 
                 // test clone()
@@ -595,6 +595,22 @@ namespace TrenchBroom {
             PickResult hits2;
             brush.pick(vm::ray3(vm::vec3(8.0, -8.0, 8.0), vm::vec3::neg_y()), hits2);
             ASSERT_TRUE(hits2.empty());
+
+            // the ray enters the brush through the top face
+            PickResult hits3;
+            brush.pick(vm::ray3(vm::vec3(8.0, 8.0, 32.0), vm::normalize(vm::vec3(-1.0, 0.0, -2.0))), hits3);
+            ASSERT_EQ(1u, hits3.size());
+            ASSERT_DOUBLE_EQ(vm::length(vm::vec3(-8.0, 0.0, -16.0)), hits3.all().front().distance());
+            ASSERT_EQ(top, hits3.all().front().target<BrushFace*>());
+
+            // rays starting inside of the brush do not hit it
+            PickResult hits4;
+            brush.pick(vm::ray3(vm::vec3(8.0, 8.0, 8.0), vm::vec3::pos_y()), hits4);
+            ASSERT_TRUE(hits4.empty());
+
+            ASSERT_TRUE(brush.containsPoint(vm::vec3(8.0, 8.0, 8.0)));
+            ASSERT_TRUE(brush.containsPoint(vm::vec3(16.0, 0.0, 8.0)));
+            ASSERT_FALSE(brush.containsPoint(vm::vec3(8.0, 17.0, 8.0)));
         }
 
         TEST(BrushTest, partialSelectionAfterAdd) {
@@ -21,7 +21,9 @@
 
 #include "Model/BrushBuilder.h"
 #include "Model/EditorContext.h"
+#include "Model/EditorStateGeneration.h"
 #include "Model/LockState.h"
+#include "Model/Tag.h"
 #include "Model/VisibilityState.h"
 #include "Model/World.h"
 #include "Model/Layer.h"
@@ -811,5 +813,69 @@ namespace TrenchBroom {
             context.popGroup();
             context.popGroup();
         }
+
+        /************* Cached State Tests *************/
+
+        TEST_F(EditorContextTest, testCachedStateIsInvalidatedByParent) {
+            auto* brush = createTopLevelBrush();
+            auto* layer = world->defaultLayer();
+            ASSERT_TRUE(context.visible(brush));
+            ASSERT_TRUE(context.editable(brush));
+
+            layer->setVisibilityState(VisibilityState::Visibility_Hidden);
+            layer->setLockState(LockState::Lock_Locked);
+            ASSERT_FALSE(context.visible(brush));
+            ASSERT_FALSE(context.editable(brush));
+
+            layer->setVisibilityState(VisibilityState::Visibility_Inherited);
+            layer->setLockState(LockState::Lock_Inherited);
+            ASSERT_TRUE(context.visible(brush));
+            ASSERT_TRUE(context.editable(brush));
+        }
+
+        TEST_F(EditorContextTest, testCachedStateIsInvalidatedByChildren) {
+            Entity* entity;
+            Brush* brush;
+            std::tie(entity, brush) = createTopLevelBrushEntity();
+            ASSERT_TRUE(context.visible(entity));
+
+            brush->setVisibilityState(VisibilityState::Visibility_Hidden);
+            ASSERT_FALSE(context.visible(entity));
+        }
+
+        TEST_F(EditorContextTest, testCachedStateIsInvalidatedByTags) {
+            auto* brush = createTopLevelBrush();
+
+            Tag tag("tag", {});
+            tag.setIndex(0);
+
+            context.setHiddenTags(tag.type());
+            ASSERT_TRUE(context.visible(brush));
+
+            brush->addTag(tag);
+            ASSERT_FALSE(context.visible(brush));
+
+            brush->removeTag(tag);
+            ASSERT_TRUE(context.visible(brush));
+
+            brush->addTag(tag);
+            context.setHiddenTags(TagType::NoType);
+            ASSERT_TRUE(context.visible(brush));
+        }
+
+        TEST_F(EditorContextTest, testCachedStateIsKeptWhenBrushGeometryChanges) {
+            auto* brush = createTopLevelBrush();
+            ASSERT_TRUE(context.visible(brush));
+
+            const auto generation = EditorStateGeneration::current();
+            auto* top = brush->findFace(vm::vec3::pos_z());
+            ASSERT_NE(nullptr, top);
+
+            // moving a face does not change the face set of the brush
+            brush->moveBoundary(worldBounds, top, vm::vec3(0.0, 0.0, 16.0), false);
+            ASSERT_EQ(6u, brush->faces().size());
+            ASSERT_EQ(generation, EditorStateGeneration::current());
+            ASSERT_TRUE(context.visible(brush));
+        }
     }
 }
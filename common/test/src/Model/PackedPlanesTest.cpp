@@ -0,0 +1,106 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Model/PackedPlanes.h"
+
+#include <vecmath/plane.h>
+#include <vecmath/ray.h>
+#include <vecmath/scalar.h>
+#include <vecmath/vec.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        static std::vector<vm::plane3d> makeCubePlanes(const double size) {
+            return {
+                vm::plane3d(size, vm::vec3d::pos_x()),
+                vm::plane3d(size, vm::vec3d::neg_x()),
+                vm::plane3d(size, vm::vec3d::pos_y()),
+                vm::plane3d(size, vm::vec3d::neg_y()),
+                vm::plane3d(size, vm::vec3d::pos_z()),
+                vm::plane3d(size, vm::vec3d::neg_z()),
+            };
+        }
+
+        TEST(PackedPlanesTest, createPackedPlanes) {
+            const auto planes = makeCubePlanes(16.0);
+            const auto packed = PackedPlanes<double>(planes);
+
+            ASSERT_EQ(planes.size(), packed.size());
+            for (std::size_t i = 0u; i < planes.size(); ++i) {
+                ASSERT_EQ(planes[i], packed.plane(i));
+            }
+
+            ASSERT_TRUE(PackedPlanes<double>().empty());
+        }
+
+        TEST(PackedPlanesTest, contains) {
+            const auto packed = PackedPlanes<double>(makeCubePlanes(16.0));
+
+            ASSERT_TRUE(packed.contains(vm::vec3d(0.0, 0.0, 0.0)));
+            ASSERT_TRUE(packed.contains(vm::vec3d(16.0, 16.0, 16.0)));
+            ASSERT_TRUE(packed.contains(vm::vec3d(-16.0, 8.0, 0.0)));
+            ASSERT_FALSE(packed.contains(vm::vec3d(16.1, 0.0, 0.0)));
+            ASSERT_FALSE(packed.contains(vm::vec3d(0.0, -17.0, 0.0)));
+
+            // every point is contained in an empty set of planes
+            ASSERT_TRUE(PackedPlanes<double>().contains(vm::vec3d(0.0, 0.0, 0.0)));
+        }
+
+        TEST(PackedPlanesTest, intersectWithRay) {
+            const auto planes = makeCubePlanes(16.0);
+            const auto packed = PackedPlanes<double>(planes);
+
+            const auto [distance, index] = packed.intersectWithRay(vm::ray3d(vm::vec3d(-32.0, 0.0, 0.0), vm::vec3d::pos_x()));
+            ASSERT_DOUBLE_EQ(16.0, distance);
+            ASSERT_EQ(1u, index);
+
+            const auto [diagonalDistance, diagonalIndex] = packed.intersectWithRay(vm::ray3d(vm::vec3d(8.0, 8.0, 32.0), vm::normalize(vm::vec3d(-1.0, 0.0, -2.0))));
+            ASSERT_DOUBLE_EQ(vm::length(vm::vec3d(-8.0, 0.0, -16.0)), diagonalDistance);
+            ASSERT_EQ(4u, diagonalIndex);
+
+            // the ray points away from the volume
+            ASSERT_TRUE(vm::is_nan(packed.intersectWithRay(vm::ray3d(vm::vec3d(-32.0, 0.0, 0.0), vm::vec3d::neg_x())).first));
+
+            // the ray passes the volume
+            ASSERT_TRUE(vm::is_nan(packed.intersectWithRay(vm::ray3d(vm::vec3d(-32.0, 0.0, 0.0), vm::normalize(vm::vec3d(1.0, 1.0, 0.0)))).first));
+
+            // the ray is parallel to a plane and above it
+            ASSERT_TRUE(vm::is_nan(packed.intersectWithRay(vm::ray3d(vm::vec3d(-32.0, 0.0, 17.0), vm::vec3d::pos_x())).first));
+
+            // the ray starts inside of the volume
+            ASSERT_TRUE(vm::is_nan(packed.intersectWithRay(vm::ray3d(vm::vec3d(0.0, 0.0, 0.0), vm::vec3d::pos_x())).first));
+        }
+
+        TEST(PackedPlanesTest, convertComponentType) {
+            const auto packed = PackedPlanes<float>(makeCubePlanes(16.0));
+
+            ASSERT_TRUE(packed.contains(vm::vec3f(16.0f, 0.0f, 0.0f)));
+            ASSERT_FALSE(packed.contains(vm::vec3f(17.0f, 0.0f, 0.0f)));
+
+            const auto [distance, index] = packed.intersectWithRay(vm::ray3f(vm::vec3f(0.0f, -32.0f, 0.0f), vm::vec3f::pos_y()));
+            ASSERT_FLOAT_EQ(16.0f, distance);
+            ASSERT_EQ(3u, index);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Model/PlanePointStatus.h"
+
+#include <vecmath/plane.h>
+#include <vecmath/vec.h>
+
+#include <random>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Model {
+        template <typename T>
+        static void assertPointStatusCountsMatch(const vm::plane<T,3>& plane, const std::vector<vm::vec<T,3>>& points) {
+            // check every prefix so that the remainder loop is exercised for every possible remainder
+            for (size_t count = 0u; count <= points.size(); ++count) {
+                PointStatusCounts expected;
+                for (size_t i = 0u; i < count; ++i) {
+                    switch (plane.point_status(points[i])) {
+                        case vm::plane_status::above:
+                            ++expected.above;
+                            break;
+                        case vm::plane_status::below:
+                            ++expected.below;
+                            break;
+                        case vm::plane_status::inside:
+                            ++expected.inside;
+                            break;
+                    }
+                }
+
+                const auto actual = countPointStatus(plane, points.data(), count, vm::constants<T>::point_status_epsilon());
+                ASSERT_EQ(expected.above, actual.above);
+                ASSERT_EQ(expected.below, actual.below);
+                ASSERT_EQ(expected.inside, actual.inside);
+            }
+        }
+
+        template <typename T>
+        static void testCountPointStatus() {
+            const auto plane = vm::plane<T,3>(vm::vec<T,3>(T(16), T(-8), T(32)), vm::normalize(vm::vec<T,3>(T(1), T(2), T(3))));
+
+            std::mt19937 gen(0u);
+            std::uniform_real_distribution<T> dist(T(-256), T(256));
+
+            std::vector<vm::vec<T,3>> points;
+            for (size_t i = 0u; i < 37u; ++i) {
+                const auto point = vm::vec<T,3>(dist(gen), dist(gen), dist(gen));
+                points.push_back(point);
+                // also add the projection of the point onto the plane, which is inside, and points just above and
+                // below the epsilon band
+                const auto projected = plane.project_point(point);
+                points.push_back(projected);
+                points.push_back(projected + plane.normal * vm::constants<T>::point_status_epsilon() * T(2));
+                points.push_back(projected - plane.normal * vm::constants<T>::point_status_epsilon() * T(2));
+            }
+
+            assertPointStatusCountsMatch(plane, points);
+        }
+
+        TEST(PlanePointStatusTest, countPointStatusDouble) {
+            testCountPointStatus<double>();
+        }
+
+        TEST(PlanePointStatusTest, countPointStatusFloat) {
+            testCountPointStatus<float>();
+        }
+    }
+}
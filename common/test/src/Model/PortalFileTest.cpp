@@ -21,6 +21,7 @@
 
 #include <memory>
 
+#include "Exceptions.h"
 #include "Model/PortalFile.h"
 #include "IO/DiskIO.h"
 #include "IO/Path.h"
@@ -36,6 +37,12 @@ namespace TrenchBroom {
             EXPECT_ANY_THROW(const Model::PortalFile p = Model::PortalFile(path));
         }
 
+        TEST(PortalFileTest, parsePRT1WithTooManyPoints) {
+            const auto path = IO::Path("fixture/test/Model/PortalFile/portaltest_prt1_too_many_points.prt");
+
+            EXPECT_THROW(const Model::PortalFile p = Model::PortalFile(path), FileFormatException);
+        }
+
         static const std::vector<vm::polygon3f> ExpectedPortals {
                 {{-96,-32,80}, {-96,160,80}, {0,160,80}, {0,-32,80}},
                 {{208,-64,80}, {64,-64,80}, {64,160,80}, {208,160,80}},
@@ -28,6 +28,8 @@
 
 #include "Assets/Texture.h"
 
+#include <vector>
+
 namespace TrenchBroom {
     namespace Model {
         // Disable a clang warning when using ASSERT_DEATH
@@ -53,5 +55,40 @@ namespace TrenchBroom {
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
+
+        static void assertBatchTexCoordsMatch(const TexCoordSystem& texCoordSystem, const BrushFaceAttributes& attribs) {
+            // an odd number of points exercises the remainder loop after the vectorized loop
+            std::vector<vm::vec3> points;
+            for (size_t i = 0; i < 23; ++i) {
+                const auto f = static_cast<FloatType>(i);
+                points.emplace_back(f * 17.25 - 128.0, 3.0 - f * f * 0.5, f * 1024.125);
+            }
+
+            std::vector<vm::vec2f> texCoords(points.size());
+            texCoordSystem.getTexCoords(points.data(), points.size(), attribs, texCoords.data());
+
+            for (size_t i = 0; i < points.size(); ++i) {
+                const auto expected = texCoordSystem.getTexCoords(points[i], attribs);
+                ASSERT_FLOAT_EQ(expected.x(), texCoords[i].x());
+                ASSERT_FLOAT_EQ(expected.y(), texCoords[i].y());
+            }
+        }
+
+        TEST(TexCoordSystemTest, batchTexCoords) {
+            Assets::Texture texture("texture", 64, 32);
+
+            BrushFaceAttributes attribs("texture");
+            attribs.setTexture(&texture);
+            attribs.setOffset(vm::vec2f(3.5f, -12.0f));
+            attribs.setScale(vm::vec2f(0.5f, -2.0f));
+
+            const ParaxialTexCoordSystem paraxial(vm::vec3(0.0, 0.0, 0.0), vm::vec3(0.0, 1.0, 0.0), vm::vec3(1.0, 0.0, 0.0), attribs);
+            assertBatchTexCoordsMatch(paraxial, attribs);
+
+            const ParallelTexCoordSystem parallel(vm::normalize(vm::vec3(1.0, 2.0, 0.5)), vm::normalize(vm::vec3(-2.0, 1.0, 0.0)));
+            assertBatchTexCoordsMatch(parallel, attribs);
+
+            attribs.unsetTexture();
+        }
     }
 }
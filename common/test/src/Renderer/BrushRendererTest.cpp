@@ -0,0 +1,90 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Assets/Texture.h"
+#include "Model/Brush.h"
+#include "Model/BrushBuilder.h"
+#include "Model/BrushFace.h"
+#include "Model/MapFormat.h"
+#include "Model/World.h"
+#include "Renderer/BrushRenderer.h"
+#include "Renderer/BrushRendererBrushCache.h"
+
+#include <vecmath/bbox.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Renderer {
+        TEST(BrushRendererTest, regenerateVerticesOnlyWhenNecessary) {
+            const vm::bbox3 worldBounds(4096.0);
+            Model::World world(Model::MapFormat::Standard);
+            Model::BrushBuilder builder(&world, worldBounds);
+
+            // the textures must outlive the brush
+            Assets::Texture texture("texture", 64, 64);
+            Assets::Texture sameSizeTexture("same_size", 64, 64);
+            Assets::Texture otherSizeTexture("other_size", 32, 64);
+
+            auto brush = std::unique_ptr<Model::Brush>(builder.createCube(64.0, "texture"));
+            const auto vertexCount = 6u * 4u;
+
+            for (auto* face : brush->faces()) {
+                face->setTexture(&texture);
+            }
+
+            BrushRenderer renderer;
+            renderer.addBrushes({ brush.get() });
+            renderer.validate();
+            ASSERT_EQ(1u, renderer.statistics().validatedBrushes);
+            ASSERT_EQ(vertexCount, renderer.statistics().regeneratedVertices);
+            ASSERT_EQ(vertexCount, renderer.statistics().uploadedVertices);
+
+            // selection changes only affect the index lists
+            brush->faces().front()->select();
+            renderer.invalidateBrushes({ brush.get() });
+            renderer.validate();
+            ASSERT_EQ(0u, renderer.statistics().regeneratedVertices);
+            ASSERT_EQ(vertexCount, renderer.statistics().uploadedVertices);
+            brush->faces().front()->deselect();
+
+            // a texture of the same size does not change the texture coordinates
+            brush->faces().front()->setTexture(&sameSizeTexture);
+            renderer.invalidateBrushes({ brush.get() });
+            renderer.validate();
+            ASSERT_EQ(0u, renderer.statistics().regeneratedVertices);
+
+            const auto& cachedFaces = brush->brushRendererBrushCache().cachedFacesSortedByTexture();
+            ASSERT_EQ(1u, std::count_if(std::begin(cachedFaces), std::end(cachedFaces), [&](const auto& cachedFace) {
+                return cachedFace.texture == &sameSizeTexture;
+            }));
+
+            brush->faces().front()->setTexture(&otherSizeTexture);
+            renderer.invalidateBrushes({ brush.get() });
+            renderer.validate();
+            ASSERT_EQ(vertexCount, renderer.statistics().regeneratedVertices);
+
+            renderer.clear();
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Renderer/GLVertex.h"
+#include "Renderer/PortalFileMesh.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/bbox_io.h>
+#include <vecmath/plane.h>
+#include <vecmath/polygon.h>
+#include <vecmath/vec.h>
+#include <vecmath/vec_io.h>
+
+#include <vector>
+
+namespace TrenchBroom {
+    namespace Renderer {
+        static vm::polygon3f makeQuad(const vm::vec3f& origin) {
+            return vm::polygon3f({
+                origin,
+                origin + vm::vec3f(0.0f, 64.0f, 0.0f),
+                origin + vm::vec3f(64.0f, 64.0f, 0.0f),
+                origin + vm::vec3f(64.0f, 0.0f, 0.0f),
+            });
+        }
+
+        static std::vector<vm::polygon3f> makePortals() {
+            return {
+                makeQuad(vm::vec3f(0.0f, 0.0f, 0.0f)),
+                makeQuad(vm::vec3f(128.0f, 0.0f, 0.0f)),
+                vm::polygon3f({ vm::vec3f(5000.0f, 0.0f, 0.0f), vm::vec3f(5000.0f, 64.0f, 0.0f), vm::vec3f(5064.0f, 0.0f, 0.0f) }),
+                makeQuad(vm::vec3f(256.0f, 0.0f, 0.0f)),
+                makeQuad(vm::vec3f(-2000.0f, 0.0f, 0.0f)),
+            };
+        }
+
+        TEST(PortalFileMeshTest, createEmptyMesh) {
+            const auto mesh = PortalFileMesh(std::vector<vm::polygon3f>());
+            ASSERT_TRUE(mesh.buckets().empty());
+            ASSERT_TRUE(mesh.vertices().empty());
+            ASSERT_EQ(0u, mesh.portalCount());
+        }
+
+        TEST(PortalFileMeshTest, createMesh) {
+            const auto portals = makePortals();
+            const auto mesh = PortalFileMesh(portals, 1024.0f);
+
+            ASSERT_EQ(portals.size(), mesh.portalCount());
+            ASSERT_EQ(3u, mesh.buckets().size());
+
+            // a quad has two triangles and four line segments, a triangle has one triangle and three line segments
+            const auto triangleVertexCount = 4u * 6u + 3u;
+            const auto lineVertexCount = 4u * 8u + 6u;
+            ASSERT_EQ(triangleVertexCount + lineVertexCount, mesh.vertices().size());
+
+            const auto& first = mesh.buckets()[0];
+            ASSERT_EQ(3u, first.portalCount);
+            ASSERT_EQ(0u, first.triangleIndex);
+            ASSERT_EQ(18u, first.triangleCount);
+            ASSERT_EQ(triangleVertexCount, first.lineIndex);
+            ASSERT_EQ(24u, first.lineCount);
+            ASSERT_EQ(vm::bbox3f(vm::vec3f(0.0f, 0.0f, 0.0f), vm::vec3f(320.0f, 64.0f, 0.0f)), first.bounds);
+
+            const auto& second = mesh.buckets()[1];
+            ASSERT_EQ(1u, second.portalCount);
+            ASSERT_EQ(18u, second.triangleIndex);
+            ASSERT_EQ(3u, second.triangleCount);
+            ASSERT_EQ(triangleVertexCount + 24u, second.lineIndex);
+            ASSERT_EQ(6u, second.lineCount);
+
+            const auto& third = mesh.buckets()[2];
+            ASSERT_EQ(1u, third.portalCount);
+            ASSERT_EQ(21u, third.triangleIndex);
+            ASSERT_EQ(6u, third.triangleCount);
+
+            // the first portal is triangulated as a fan, and its outline is closed
+            const auto position = [&](const size_t i) { return getVertexComponent<0>(mesh.vertices()[i]); };
+            const auto& quad = portals[0].vertices();
+            ASSERT_EQ(quad[0], position(0));
+            ASSERT_EQ(quad[1], position(1));
+            ASSERT_EQ(quad[2], position(2));
+            ASSERT_EQ(quad[0], position(3));
+            ASSERT_EQ(quad[2], position(4));
+            ASSERT_EQ(quad[3], position(5));
+            ASSERT_EQ(quad[3], position(first.lineIndex + 6u));
+            ASSERT_EQ(quad[0], position(first.lineIndex + 7u));
+        }
+
+        TEST(PortalFileMeshTest, visibleBuckets) {
+            const auto mesh = PortalFileMesh(makePortals(), 1024.0f);
+            const auto position = vm::vec3f(0.0f, 0.0f, 0.0f);
+
+            ASSERT_EQ(std::vector<size_t>({ 0u, 1u, 2u }), mesh.visibleBuckets({}, position, 0u));
+
+            // the bucket beyond x = 1024 is culled
+            const auto planes = std::vector<vm::plane3f>({ vm::plane3f(1024.0f, vm::vec3f::pos_x()) });
+            ASSERT_EQ(std::vector<size_t>({ 0u, 2u }), mesh.visibleBuckets(planes, position, 0u));
+        }
+
+        TEST(PortalFileMeshTest, visibleBucketsWithMaximumPortalCount) {
+            const auto mesh = PortalFileMesh(makePortals(), 1024.0f);
+            const auto position = vm::vec3f(5000.0f, 0.0f, 0.0f);
+
+            // the buckets are added by their distance until the next one would exceed the maximum
+            ASSERT_EQ(std::vector<size_t>({ 1u }), mesh.visibleBuckets({}, position, 1u));
+            ASSERT_EQ(std::vector<size_t>({ 1u }), mesh.visibleBuckets({}, position, 3u));
+            ASSERT_EQ(std::vector<size_t>({ 1u, 0u }), mesh.visibleBuckets({}, position, 4u));
+            ASSERT_EQ(std::vector<size_t>({ 1u, 0u, 2u }), mesh.visibleBuckets({}, position, 5u));
+        }
+
+        TEST(PortalFileMeshTest, visibleBucketsAlwaysContainClosestBucket) {
+            const auto mesh = PortalFileMesh(makePortals(), 1024.0f);
+            const auto position = vm::vec3f(0.0f, 0.0f, 0.0f);
+
+            // the closest bucket contains three portals, which exceeds the maximum
+            ASSERT_EQ(std::vector<size_t>({ 0u }), mesh.visibleBuckets({}, position, 1u));
+
+            // if the closest bucket is culled, the closest visible bucket is returned instead
+            const auto planes = std::vector<vm::plane3f>({ vm::plane3f(-1024.0f, vm::vec3f::neg_x()) });
+            ASSERT_EQ(std::vector<size_t>({ 1u }), mesh.visibleBuckets(planes, position, 1u));
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "View/CellLayout.h"
+
+namespace TrenchBroom {
+    namespace View {
+        static CellLayout makeLayout(const int itemCount) {
+            // two cells of 100x100 fit into each row
+            CellLayout layout;
+            layout.setWidth(250.0f);
+            for (int i = 0; i < itemCount; ++i) {
+                layout.addItem(QVariant(i), 100.0f, 100.0f, 0.0f, 0.0f);
+            }
+            return layout;
+        }
+
+        TEST(CellLayoutTest, indexOfRowAt) {
+            auto layout = makeLayout(6);
+            ASSERT_EQ(1u, layout.size());
+
+            const auto& group = layout[0];
+            ASSERT_EQ(3u, group.size());
+
+            ASSERT_EQ(0u, group.indexOfRowAt(0.0f));
+            ASSERT_EQ(0u, group.indexOfRowAt(50.0f));
+            ASSERT_EQ(1u, group.indexOfRowAt(100.0f));
+            ASSERT_EQ(2u, group.indexOfRowAt(250.0f));
+            ASSERT_EQ(3u, group.indexOfRowAt(300.0f));
+            ASSERT_EQ(3u, group.indexOfRowAt(1000.0f));
+        }
+
+        TEST(CellLayoutTest, cellAt) {
+            auto layout = makeLayout(6);
+
+            const LayoutCell* cell = nullptr;
+            ASSERT_TRUE(layout.cellAt(150.0f, 150.0f, &cell));
+            ASSERT_EQ(3, cell->item().toInt());
+
+            ASSERT_TRUE(layout.cellAt(50.0f, 250.0f, &cell));
+            ASSERT_EQ(4, cell->item().toInt());
+
+            ASSERT_FALSE(layout.cellAt(50.0f, 350.0f, &cell));
+            ASSERT_FALSE(layout.cellAt(225.0f, 50.0f, &cell));
+        }
+    }
+}
@@ -40,6 +40,8 @@
 #include "View/PasteType.h"
 #include "View/SelectionTool.h"
 
+#include <kdl/vector_utils.h>
+
 #include <vecmath/bbox.h>
 #include <vecmath/scalar.h>
 #include <vecmath/ray.h>
@@ -465,6 +467,72 @@ namespace TrenchBroom {
             EXPECT_EQ(expectedBBox2, remainder2->logicalBounds());
         }
 
+        TEST_F(MapDocumentTest, csgSubtractKeepsDisjointBrushes) {
+            const Model::BrushBuilder builder(document->world(), document->worldBounds());
+
+            auto* entity = new Model::Entity();
+            document->addNode(entity, document->currentParent());
+
+            Model::Brush* minuend = builder.createCuboid(vm::bbox3(vm::vec3(0, 0, 0), vm::vec3(64, 64, 64)), "texture");
+            Model::Brush* disjoint = builder.createCuboid(vm::bbox3(vm::vec3(128, 0, 0), vm::vec3(192, 64, 64)), "texture");
+            Model::Brush* subtrahend = builder.createCuboid(vm::bbox3(vm::vec3(0, 0, 0), vm::vec3(64, 64, 32)), "texture");
+
+            document->addNodes(std::vector<Model::Node*>{minuend, disjoint, subtrahend}, entity);
+            ASSERT_EQ(3u, entity->children().size());
+
+            document->select(std::vector<Model::Node*>{subtrahend});
+            ASSERT_TRUE(document->csgSubtract());
+            ASSERT_EQ(2u, entity->children().size());
+
+            // the disjoint brush is left alone
+            EXPECT_EQ(entity, disjoint->parent());
+            EXPECT_EQ(nullptr, minuend->parent());
+
+            auto* remainder = dynamic_cast<Model::Brush*>(entity->children()[0] == disjoint ? entity->children()[1] : entity->children()[0]);
+            ASSERT_NE(nullptr, remainder);
+            EXPECT_EQ(vm::bbox3(vm::vec3(0, 0, 32), vm::vec3(64, 64, 64)), remainder->logicalBounds());
+            EXPECT_EQ(std::vector<Model::Brush*>({ remainder }), document->selectedNodes().brushes());
+        }
+
+        TEST_F(MapDocumentTest, csgSubtractSkipsBrushesOnlyTouchingTheSubtrahendBounds) {
+            const Model::BrushBuilder builder(document->world(), document->worldBounds());
+
+            auto* entity = new Model::Entity();
+            document->addNode(entity, document->currentParent());
+
+            // a tetrahedron in the corner of its bounds
+            Model::Brush* subtrahend = builder.createBrush(std::vector<vm::vec3>{
+                vm::vec3(0, 0, 0),
+                vm::vec3(64, 0, 0),
+                vm::vec3(0, 64, 0),
+                vm::vec3(0, 0, 64)
+            }, "texture");
+
+            // inside the bounds of the subtrahend, but outside of its geometry
+            Model::Brush* outside = builder.createCuboid(vm::bbox3(vm::vec3(48, 48, 48), vm::vec3(64, 64, 64)), "texture");
+            // intersects the geometry of the subtrahend
+            Model::Brush* inside = builder.createCuboid(vm::bbox3(vm::vec3(0, 0, 0), vm::vec3(16, 16, 16)), "texture");
+
+            ASSERT_TRUE(subtrahend->logicalBounds().intersects(outside->logicalBounds()));
+            ASSERT_FALSE(subtrahend->intersects(outside));
+            ASSERT_TRUE(subtrahend->intersects(inside));
+
+            document->addNodes(std::vector<Model::Node*>{subtrahend, outside, inside}, entity);
+
+            document->select(std::vector<Model::Node*>{subtrahend});
+            ASSERT_TRUE(document->csgSubtract());
+
+            // the brush outside of the subtrahend's geometry is neither replaced nor selected
+            EXPECT_EQ(entity, outside->parent());
+            EXPECT_EQ(vm::bbox3(vm::vec3(48, 48, 48), vm::vec3(64, 64, 64)), outside->logicalBounds());
+            EXPECT_EQ(nullptr, inside->parent());
+            EXPECT_EQ(nullptr, subtrahend->parent());
+
+            const auto selectedBrushes = document->selectedNodes().brushes();
+            EXPECT_FALSE(selectedBrushes.empty());
+            EXPECT_FALSE(kdl::vec_contains(selectedBrushes, outside));
+        }
+
         TEST_F(MapDocumentTest, csgSubtractAndUndoRestoresSelection) {
             const Model::BrushBuilder builder(document->world(), document->worldBounds());
 
@@ -21,6 +21,7 @@
 
 #include "Model/Brush.h"
 #include "Model/BrushBuilder.h"
+#include "Model/Entity.h"
 #include "Model/Group.h"
 #include "Model/Layer.h"
 #include "Model/NodeCollection.h"
@@ -28,6 +29,8 @@
 #include "View/MapDocumentTest.h"
 #include "View/MapDocument.h"
 
+#include <kdl/vector_utils.h>
+
 namespace TrenchBroom {
     namespace View {
         class SelectionTest : public MapDocumentTest {};
@@ -91,5 +94,33 @@ namespace TrenchBroom {
 
             ASSERT_EQ(1u, document->selectedNodes().nodeCount());
         }
+
+        TEST_F(SelectionTest, selectInside) {
+            document->selectAllNodes();
+            document->deleteObjects();
+            assert(document->selectedNodes().nodeCount() == 0);
+
+            Model::BrushBuilder builder(document->world(), document->worldBounds());
+
+            Model::Brush* insideBrush = builder.createCuboid(vm::bbox3(vm::vec3(-32.0, -32.0, -32.0), vm::vec3(+32.0, +32.0, +32.0)), "texture");
+            Model::Brush* overlappingBrush = builder.createCuboid(vm::bbox3(vm::vec3(32.0, 32.0, 32.0), vm::vec3(64.0, 64.0, 64.0)), "texture");
+            Model::Brush* outsideBrush = builder.createCuboid(vm::bbox3(vm::vec3(128.0, 128.0, 128.0), vm::vec3(160.0, 160.0, 160.0)), "texture");
+            Model::Entity* entity = new Model::Entity();
+            document->addNode(insideBrush, document->currentParent());
+            document->addNode(overlappingBrush, document->currentParent());
+            document->addNode(outsideBrush, document->currentParent());
+            document->addNode(entity, document->currentParent());
+
+            Model::Brush* selectionBrush = builder.createCuboid(vm::bbox3(vm::vec3(-48.0, -48.0, -48.0), vm::vec3(+48.0, +48.0, +48.0)), "texture");
+            document->addNode(selectionBrush, document->currentParent());
+
+            document->select(selectionBrush);
+            document->selectInside(true);
+
+            const auto& selectedNodes = document->selectedNodes().nodes();
+            ASSERT_EQ(2u, selectedNodes.size());
+            ASSERT_TRUE(kdl::vec_contains(selectedNodes, insideBrush));
+            ASSERT_TRUE(kdl::vec_contains(selectedNodes, entity));
+        }
     }
 }
@@ -493,5 +493,56 @@ namespace TrenchBroom {
                 }
             }
         }
+
+        TEST_F(TagManagementTest, tagUpdateBrushFaceTagsAfterChangingTexture) {
+            auto* brush = createBrush("asdf");
+            document->addNode(brush, document->currentParent());
+
+            const auto& textureTag = document->smartTag("texture");
+            const auto& surfaceParmTag = document->smartTag("surfaceparm");
+
+            auto* face = brush->faces().front();
+            ASSERT_FALSE(face->hasTag(textureTag));
+            ASSERT_FALSE(face->hasTag(surfaceParmTag));
+
+            Model::ChangeBrushFaceAttributesRequest request;
+            request.setTexture(m_matchingTexture);
+
+            document->select(face);
+            document->setFaceAttributes(request);
+            document->deselectAll();
+
+            ASSERT_TRUE(face->hasTag(textureTag));
+            ASSERT_TRUE(face->hasTag(surfaceParmTag));
+        }
+
+        TEST_F(TagManagementTest, tagUpdateBrushFaceTagsOnlyForChangedProperties) {
+            auto* brush = createBrush("some_texture");
+            document->addNode(brush, document->currentParent());
+
+            const auto& textureTag = document->smartTag("texture");
+            const auto& contentFlagsTag = document->smartTag("contentflags");
+
+            auto* face = brush->faces().front();
+            ASSERT_TRUE(face->hasTag(textureTag));
+
+            // a stale texture tag must not be refreshed by a change that does not affect the texture
+            face->removeTag(textureTag);
+
+            Model::ChangeBrushFaceAttributesRequest request;
+            request.setContentFlag(0);
+
+            document->select(face);
+            document->setFaceAttributes(request);
+
+            ASSERT_TRUE(face->hasTag(contentFlagsTag));
+            ASSERT_FALSE(face->hasTag(textureTag));
+
+            // restoring a snapshot updates all tags
+            document->undoCommand();
+
+            ASSERT_FALSE(face->hasTag(contentFlagsTag));
+            ASSERT_TRUE(face->hasTag(textureTag));
+        }
     }
 }
@@ -0,0 +1,157 @@
+/*
+ Copyright 2010-2020 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef KDL_PARALLEL_H
+#define KDL_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace kdl {
+    /**
+     * Returns the number of worker threads to use for a parallel operation on the given number of tasks. This is the
+     * number of hardware threads, but at least 1 and at most the number of tasks.
+     *
+     * @param task_count the number of tasks
+     * @return the number of worker threads to use
+     */
+    inline std::size_t parallel_worker_count(const std::size_t task_count) {
+        const auto hardware_threads = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), std::size_t(1));
+        return std::min(hardware_threads, task_count);
+    }
+
+    /**
+     * Calls the given function for every index in [0, count). The calls are distributed over a number of worker
+     * threads, so the given function must be safe to call concurrently for different indices. The order in which the
+     * indices are processed is unspecified.
+     *
+     * This function returns when all calls have finished. If any of the calls throws an exception, the remaining
+     * indices are still processed, and one of the exceptions is rethrown afterwards.
+     *
+     * @tparam F the type of the function to call, must be callable with a std::size_t
+     * @param count the number of indices
+     * @param func the function to call
+     */
+    template <typename F>
+    void parallel_for(const std::size_t count, const F& func) {
+        std::atomic<std::size_t> next_index(0u);
+        const auto worker = [&]() {
+            std::exception_ptr exception;
+            for (auto i = next_index++; i < count; i = next_index++) {
+                try {
+                    func(i);
+                } catch (...) {
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        };
+
+        const auto worker_count = parallel_worker_count(count);
+        if (worker_count <= 1u) {
+            worker();
+            return;
+        }
+
+        // the calling thread is one of the workers
+        std::vector<std::future<void>> futures;
+        futures.reserve(worker_count - 1u);
+        for (std::size_t i = 0u; i < worker_count - 1u; ++i) {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+
+        std::exception_ptr exception;
+        try {
+            worker();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+
+        for (auto& future : futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /**
+     * Applies the given function to every element in the given range and returns a vector containing the results in
+     * the order of the range. The function is applied in parallel as by `parallel_for`, so it must be safe to call
+     * concurrently for different elements.
+     *
+     * @tparam I the type of the range iterators, must be random access iterators
+     * @tparam F the type of the function to apply
+     * @param begin the start of the range
+     * @param end the end of the range
+     * @param func the function to apply
+     * @return a vector containing the results
+     */
+    template <typename I, typename F>
+    auto parallel_transform(I begin, I end, const F& func) {
+        using result_type = std::decay_t<decltype(func(*begin))>;
+
+        const auto count = static_cast<std::size_t>(std::distance(begin, end));
+        std::vector<std::optional<result_type>> results(count);
+        parallel_for(count, [&](const std::size_t i) {
+            results[i] = func(*std::next(begin, static_cast<typename std::iterator_traits<I>::difference_type>(i)));
+        });
+
+        std::vector<result_type> result;
+        result.reserve(count);
+        for (auto& r : results) {
+            result.push_back(std::move(*r));
+        }
+        return result;
+    }
+
+    /**
+     * Applies the given function to every element of the given collection and returns a vector containing the results
+     * in the order of the collection. See `parallel_transform` above.
+     *
+     * @tparam C the type of the collection, must provide random access iterators
+     * @tparam F the type of the function to apply
+     * @param c the collection
+     * @param func the function to apply
+     * @return a vector containing the results
+     */
+    template <typename C, typename F>
+    auto parallel_transform(const C& c, const F& func) {
+        return parallel_transform(std::begin(c), std::end(c), func);
+    }
+}
+
+#endif //KDL_PARALLEL_H
@@ -0,0 +1,74 @@
+/*
+ Copyright 2010-2020 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "kdl/parallel.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kdl {
+    TEST(parallel_test, parallel_for) {
+        const std::size_t count = 1000u;
+        std::vector<std::atomic<std::size_t>> calls(count);
+
+        parallel_for(count, [&](const std::size_t i) {
+            ++calls[i];
+        });
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            ASSERT_EQ(1u, calls[i].load());
+        }
+    }
+
+    TEST(parallel_test, parallel_for_empty) {
+        bool called = false;
+        parallel_for(0u, [&](const std::size_t) { called = true; });
+        ASSERT_FALSE(called);
+    }
+
+    TEST(parallel_test, parallel_for_rethrows) {
+        std::atomic<std::size_t> calls(0u);
+        ASSERT_THROW(parallel_for(100u, [&](const std::size_t i) {
+            ++calls;
+            if (i == 50u) {
+                throw std::runtime_error("error");
+            }
+        }), std::runtime_error);
+
+        // the remaining indices are still processed
+        ASSERT_EQ(100u, calls.load());
+    }
+
+    TEST(parallel_test, parallel_transform) {
+        auto v = std::vector<int>(1000u);
+        std::iota(std::begin(v), std::end(v), 0);
+
+        const auto result = parallel_transform(v, [](const int i) { return std::to_string(i); });
+        ASSERT_EQ(v.size(), result.size());
+        for (std::size_t i = 0u; i < v.size(); ++i) {
+            ASSERT_EQ(std::to_string(v[i]), result[i]);
+        }
+
+        ASSERT_TRUE(parallel_transform(std::vector<int>{}, [](const int i) { return i; }).empty());
+    }
+}